@@ -29,6 +29,7 @@
 #include <cstring>
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 #include <vector>
 
 #define MAX_STACK_SIZE 64
@@ -56,6 +57,15 @@ struct AABound
     G3D::Vector3 lo, hi;
 };
 
+/// Ray callbacks providing operator()(ray, entries, count, distance, stopAtFirstHit) get a whole leaf at once,
+/// which lets them test all primitives of the leaf together (see VMAP::GModelRayCallback)
+template<typename RayCallback, typename = void>
+struct BIHLeafRayCallback : std::false_type { };
+
+template<typename RayCallback>
+struct BIHLeafRayCallback<RayCallback, std::void_t<decltype(std::declval<RayCallback&>()(std::declval<G3D::Ray const&>(),
+    std::declval<uint32 const*>(), uint32(0), std::declval<float&>(), false))>> : std::true_type { };
+
 /** Bounding Interval Hierarchy Class.
     Building and Ray-Intersection functions based on BIH from
     Sunflow, a Java Raytracer, released under MIT/X11 License
@@ -231,12 +241,23 @@ public:
                     {
                         // leaf - test some objects
                         int n = tree[node + 1];
-                        while (n > 0)
+                        if constexpr (BIHLeafRayCallback<RayCallback>::value)
                         {
-                            bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
-                            if (stopAtFirstHit && hit) { return; }
-                            --n;
-                            ++offset;
+                            if (n > 0)
+                            {
+                                bool hit = intersectCallback(r, &objects[offset], uint32(n), maxDist, stopAtFirstHit);
+                                if (stopAtFirstHit && hit) { return; }
+                            }
+                        }
+                        else
+                        {
+                            while (n > 0)
+                            {
+                                bool hit = intersectCallback(r, objects[offset], maxDist, stopAtFirstHit);
+                                if (stopAtFirstHit && hit) { return; }
+                                --n;
+                                ++offset;
+                            }
                         }
                         break;
                     }
@@ -20,10 +20,13 @@
 #include "MapDefines.h"
 #include "MapTree.h"
 #include "VMapDefinitions.h"
+#include <algorithm>
+#include <atomic>
 #include <boost/filesystem.hpp>
 #include <iomanip>
 #include <set>
 #include <sstream>
+#include <thread>
 
 using G3D::Vector3;
 using G3D::AABox;
@@ -35,6 +38,34 @@ template<> struct BoundsTrait<VMAP::ModelSpawn*>
     static void GetBounds(const VMAP::ModelSpawn* const& obj, G3D::AABox& out) { out = obj->GetBounds(); }
 };
 
+namespace
+{
+    // calls work(i) for every i in [0, count) from up to threads threads, no new work is started once a call failed
+    template<class Work>
+    bool ParallelFor(uint32 threads, std::size_t count, Work&& work)
+    {
+        std::atomic<std::size_t> next{0};
+        std::atomic<bool> success{true};
+        auto worker = [&]()
+        {
+            for (std::size_t i = next++; i < count && success; i = next++)
+                if (!work(i))
+                    success = false;
+        };
+
+        std::vector<std::thread> workers;
+        for (std::size_t i = 1; i < std::min<std::size_t>(threads, count); ++i)
+            workers.emplace_back(worker);
+
+        worker();
+
+        for (std::thread& thread : workers)
+            thread.join();
+
+        return success;
+    }
+}
+
 namespace VMAP
 {
     bool readChunk(FILE* rf, char* dest, const char* compare, uint32 len)
@@ -52,8 +83,8 @@ namespace VMAP
 
     //=================================================================
 
-    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName)
-        : iDestDir(pDestDirName), iSrcDir(pSrcDirName)
+    TileAssembler::TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 threads)
+        : iDestDir(pDestDirName), iSrcDir(pSrcDirName), iThreads(std::max(1u, threads))
     {
         boost::filesystem::create_directory(iDestDir);
         //init();
@@ -72,147 +103,165 @@ namespace VMAP
             return false;
         }
 
-        // export Map data
-        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end() && success; ++map_iter)
+        // export Map data, every map writes its own files so they are converted in parallel
+        std::vector<std::pair<uint32, MapSpawns*>> maps(mapData.begin(), mapData.end());
+        success = ParallelFor(iThreads, maps.size(), [&](std::size_t i)
+        {
+            return convertMap(maps[i].first, *maps[i].second);
+        });
+
+        // add an object models, listed in temp_gameobject_models file
+        exportGameobjectModels();
+        // export objects, each model is converted exactly once no matter how many maps spawn it
+        std::cout << "\nConverting Model Files" << std::endl;
+        std::vector<std::string> modelFiles(spawnedModelFiles.begin(), spawnedModelFiles.end());
+        bool modelsConverted = ParallelFor(iThreads, modelFiles.size(), [&](std::size_t i)
         {
-            // build global map tree
-            std::vector<ModelSpawn*> mapSpawns;
-            UniqueEntryMap::iterator entry;
-            printf("Calculating model bounds for map %u...\n", map_iter->first);
-            for (entry = map_iter->second->UniqueEntries.begin(); entry != map_iter->second->UniqueEntries.end(); ++entry)
+            printf("Converting %s\n", modelFiles[i].c_str());
+            if (!convertRawFile(modelFiles[i]))
             {
-                // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
-                if (entry->second.flags & MOD_M2)
-                {
-                    if (!calculateTransformedBound(entry->second))
-                    {
-                        break;
-                    }
-                }
-                else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
-                {
-                    /// @todo remove extractor hack and uncomment below line:
-                    //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
-                    entry->second.iBound = entry->second.iBound + Vector3(533.33333f * 32, 533.33333f * 32, 0.f);
-                }
-                mapSpawns.push_back(&(entry->second));
-                spawnedModelFiles.insert(entry->second.name);
+                printf("error converting %s\n", modelFiles[i].c_str());
+                return false;
             }
 
-            printf("Creating map tree for map %u...\n", map_iter->first);
-            BIH pTree;
+            return true;
+        });
+
+        success = success && modelsConverted;
+
+        //cleanup:
+        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
+        {
+            delete map_iter->second;
+        }
+        return success;
+    }
 
-            try
+    bool TileAssembler::convertMap(uint32 mapId, MapSpawns& spawns)
+    {
+        // build global map tree
+        std::vector<ModelSpawn*> mapSpawns;
+        std::set<std::string> modelFiles;
+        UniqueEntryMap::iterator entry;
+        printf("Calculating model bounds for map %u...\n", mapId);
+        for (entry = spawns.UniqueEntries.begin(); entry != spawns.UniqueEntries.end(); ++entry)
+        {
+            // M2 models don't have a bound set in WDT/ADT placement data, i still think they're not used for LoS at all on retail
+            if (entry->second.flags & MOD_M2)
             {
-                pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::GetBounds);
+                if (!calculateTransformedBound(entry->second))
+                {
+                    break;
+                }
             }
-            catch (std::exception& e)
+            else if (entry->second.flags & MOD_WORLDSPAWN) // WMO maps and terrain maps use different origin, so we need to adapt :/
             {
-                printf("Exception ""%s"" when calling pTree.build", e.what());
-                return false;
+                /// @todo remove extractor hack and uncomment below line:
+                //entry->second.iPos += Vector3(533.33333f*32, 533.33333f*32, 0.f);
+                entry->second.iBound = entry->second.iBound + Vector3(533.33333f * 32, 533.33333f * 32, 0.f);
             }
+            mapSpawns.push_back(&(entry->second));
+            modelFiles.insert(entry->second.name);
+        }
 
-            // ===> possibly move this code to StaticMapTree class
-            std::map<uint32, uint32> modelNodeIdx;
-            for (uint32 i = 0; i < mapSpawns.size(); ++i)
-            {
-                modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
-            }
+        {
+            std::lock_guard<std::mutex> guard(spawnedModelFilesLock);
+            spawnedModelFiles.insert(modelFiles.begin(), modelFiles.end());
+        }
 
-            // write map tree file
-            std::stringstream mapfilename;
-            mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << map_iter->first << ".vmtree";
-            FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
-            if (!mapfile)
-            {
-                success = false;
-                printf("Cannot open %s\n", mapfilename.str().c_str());
-                break;
-            }
+        printf("Creating map tree for map %u...\n", mapId);
+        BIH pTree;
 
-            //general info
-            if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) { success = false; }
-            uint32 globalTileID = StaticMapTree::packTileID(65, 65);
-            pair<TileMap::iterator, TileMap::iterator> globalRange = map_iter->second->TileEntries.equal_range(globalTileID);
-            char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
-            if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) { success = false; }
-            // Nodes
-            if (success && fwrite("NODE", 4, 1, mapfile) != 1) { success = false; }
-            if (success) { success = pTree.writeToFile(mapfile); }
-            // global map spawns (WDT), if any (most instances)
-            if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) { success = false; }
-
-            for (TileMap::iterator glob = globalRange.first; glob != globalRange.second && success; ++glob)
-            {
-                success = ModelSpawn::writeToFile(mapfile, map_iter->second->UniqueEntries[glob->second]);
-            }
+        try
+        {
+            pTree.build(mapSpawns, BoundsTrait<ModelSpawn*>::GetBounds);
+        }
+        catch (std::exception& e)
+        {
+            printf("Exception ""%s"" when calling pTree.build", e.what());
+            return false;
+        }
+
+        // ===> possibly move this code to StaticMapTree class
+        std::map<uint32, uint32> modelNodeIdx;
+        for (uint32 i = 0; i < mapSpawns.size(); ++i)
+        {
+            modelNodeIdx.insert(pair<uint32, uint32>(mapSpawns[i]->ID, i));
+        }
+
+        // write map tree file
+        std::stringstream mapfilename;
+        mapfilename << iDestDir << '/' << std::setfill('0') << std::setw(3) << mapId << ".vmtree";
+        FILE* mapfile = fopen(mapfilename.str().c_str(), "wb");
+        if (!mapfile)
+        {
+            printf("Cannot open %s\n", mapfilename.str().c_str());
+            return false;
+        }
+
+        bool success = true;
+
+        //general info
+        if (success && fwrite(VMAP_MAGIC, 1, 8, mapfile) != 8) { success = false; }
+        uint32 globalTileID = StaticMapTree::packTileID(65, 65);
+        pair<TileMap::iterator, TileMap::iterator> globalRange = spawns.TileEntries.equal_range(globalTileID);
+        char isTiled = globalRange.first == globalRange.second; // only maps without terrain (tiles) have global WMO
+        if (success && fwrite(&isTiled, sizeof(char), 1, mapfile) != 1) { success = false; }
+        // Nodes
+        if (success && fwrite("NODE", 4, 1, mapfile) != 1) { success = false; }
+        if (success) { success = pTree.writeToFile(mapfile); }
+        // global map spawns (WDT), if any (most instances)
+        if (success && fwrite("GOBJ", 4, 1, mapfile) != 1) { success = false; }
+
+        for (TileMap::iterator glob = globalRange.first; glob != globalRange.second && success; ++glob)
+        {
+            success = ModelSpawn::writeToFile(mapfile, spawns.UniqueEntries[glob->second]);
+        }
 
-            fclose(mapfile);
+        fclose(mapfile);
 
-            // <====
+        // <====
 
-            // write map tile files, similar to ADT files, only with extra BSP tree node info
-            TileMap& tileEntries = map_iter->second->TileEntries;
-            TileMap::iterator tile;
-            for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+        // write map tile files, similar to ADT files, only with extra BSP tree node info
+        TileMap& tileEntries = spawns.TileEntries;
+        TileMap::iterator tile;
+        for (tile = tileEntries.begin(); tile != tileEntries.end(); ++tile)
+        {
+            const ModelSpawn& spawn = spawns.UniqueEntries[tile->second];
+            if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
             {
-                const ModelSpawn& spawn = map_iter->second->UniqueEntries[tile->second];
-                if (spawn.flags & MOD_WORLDSPAWN) // WDT spawn, saved as tile 65/65 currently...
-                {
-                    continue;
-                }
-                uint32 nSpawns = tileEntries.count(tile->first);
-                std::stringstream tilefilename;
-                tilefilename.fill('0');
-                tilefilename << iDestDir << '/' << std::setw(3) << map_iter->first << '_';
-                uint32 x, y;
-                StaticMapTree::unpackTileID(tile->first, x, y);
-                tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
-                if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
+                continue;
+            }
+            uint32 nSpawns = tileEntries.count(tile->first);
+            std::stringstream tilefilename;
+            tilefilename.fill('0');
+            tilefilename << iDestDir << '/' << std::setw(3) << mapId << '_';
+            uint32 x, y;
+            StaticMapTree::unpackTileID(tile->first, x, y);
+            tilefilename << std::setw(2) << x << '_' << std::setw(2) << y << ".vmtile";
+            if (FILE* tilefile = fopen(tilefilename.str().c_str(), "wb"))
+            {
+                // file header
+                if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) { success = false; }
+                // write number of tile spawns
+                if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) { success = false; }
+                // write tile spawns
+                for (uint32 s = 0; s < nSpawns; ++s)
                 {
-                    // file header
-                    if (success && fwrite(VMAP_MAGIC, 1, 8, tilefile) != 8) { success = false; }
-                    // write number of tile spawns
-                    if (success && fwrite(&nSpawns, sizeof(uint32), 1, tilefile) != 1) { success = false; }
-                    // write tile spawns
-                    for (uint32 s = 0; s < nSpawns; ++s)
+                    if (s)
                     {
-                        if (s)
-                        {
-                            ++tile;
-                        }
-                        const ModelSpawn& spawn2 = map_iter->second->UniqueEntries[tile->second];
-                        success = success && ModelSpawn::writeToFile(tilefile, spawn2);
-                        // MapTree nodes to update when loading tile:
-                        std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
-                        if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) { success = false; }
+                        ++tile;
                     }
-                    fclose(tilefile);
+                    const ModelSpawn& spawn2 = spawns.UniqueEntries[tile->second];
+                    success = success && ModelSpawn::writeToFile(tilefile, spawn2);
+                    // MapTree nodes to update when loading tile:
+                    std::map<uint32, uint32>::iterator nIdx = modelNodeIdx.find(spawn2.ID);
+                    if (success && fwrite(&nIdx->second, sizeof(uint32), 1, tilefile) != 1) { success = false; }
                 }
-            }
-            // break; //test, extract only first map; TODO: remvoe this line
-        }
-
-        // add an object models, listed in temp_gameobject_models file
-        exportGameobjectModels();
-        // export objects
-        std::cout << "\nConverting Model Files" << std::endl;
-        for (std::set<std::string>::iterator mfile = spawnedModelFiles.begin(); mfile != spawnedModelFiles.end(); ++mfile)
-        {
-            std::cout << "Converting " << *mfile << std::endl;
-            if (!convertRawFile(*mfile))
-            {
-                std::cout << "error converting " << *mfile << std::endl;
-                success = false;
-                break;
+                fclose(tilefile);
             }
         }
 
-        //cleanup:
-        for (MapData::iterator map_iter = mapData.begin(); map_iter != mapData.end(); ++map_iter)
-        {
-            delete map_iter->second;
-        }
         return success;
     }
 
@@ -264,21 +313,25 @@ namespace VMAP
         return success;
     }
 
-    bool TileAssembler::calculateTransformedBound(ModelSpawn& spawn)
+    std::shared_ptr<std::vector<Vector3> const> TileAssembler::getModelVertices(const std::string& pModelFilename)
     {
+        {
+            std::lock_guard<std::mutex> guard(iModelVerticesLock);
+            auto itr = iModelVertices.find(pModelFilename);
+            if (itr != iModelVertices.end())
+            {
+                return itr->second;
+            }
+        }
+
         std::string modelFilename(iSrcDir);
         modelFilename.push_back('/');
-        modelFilename.append(spawn.name);
-
-        ModelPosition modelPosition;
-        modelPosition.iDir = spawn.iRot;
-        modelPosition.iScale = spawn.iScale;
-        modelPosition.init();
+        modelFilename.append(pModelFilename);
 
         WorldModel_Raw raw_model;
         if (!raw_model.Read(modelFilename.c_str()))
         {
-            return false;
+            return nullptr;
         }
 
         uint32 groups = raw_model.groupsArray.size();
@@ -287,32 +340,52 @@ namespace VMAP
             printf("Warning: '%s' does not seem to be a M2 model!\n", modelFilename.c_str());
         }
 
+        auto vertices = std::make_shared<std::vector<Vector3>>();
+        for (uint32 g = 0; g < groups; ++g) // should be only one for M2 files...
+        {
+            std::vector<Vector3> const& groupVertices = raw_model.groupsArray[g].vertexArray;
+            if (groupVertices.empty())
+            {
+                printf("error: model '%s' has no geometry!\n", pModelFilename.c_str());
+                continue;
+            }
+
+            vertices->insert(vertices->end(), groupVertices.begin(), groupVertices.end());
+        }
+
+        // another thread may have read the same model meanwhile, both copies are identical
+        std::lock_guard<std::mutex> guard(iModelVerticesLock);
+        return iModelVertices.emplace(pModelFilename, std::move(vertices)).first->second;
+    }
+
+    bool TileAssembler::calculateTransformedBound(ModelSpawn& spawn)
+    {
+        // the same M2 is usually spawned many times, read its raw file only once
+        std::shared_ptr<std::vector<Vector3> const> vertices = getModelVertices(spawn.name);
+        if (!vertices)
+        {
+            return false;
+        }
+
+        ModelPosition modelPosition;
+        modelPosition.iDir = spawn.iRot;
+        modelPosition.iScale = spawn.iScale;
+        modelPosition.init();
+
         AABox modelBound;
         bool boundEmpty = true;
 
-        for (uint32 g = 0; g < groups; ++g) // should be only one for M2 files...
+        for (Vector3 const& vertex : *vertices)
         {
-            std::vector<Vector3>& vertices = raw_model.groupsArray[g].vertexArray;
+            Vector3 v = modelPosition.transform(vertex);
 
-            if (vertices.empty())
+            if (boundEmpty)
             {
-                std::cout << "error: model '" << spawn.name << "' has no geometry!" << std::endl;
-                continue;
+                modelBound = AABox(v, v), boundEmpty = false;
             }
-
-            uint32 nvectors = vertices.size();
-            for (uint32 i = 0; i < nvectors; ++i)
+            else
             {
-                Vector3 v = modelPosition.transform(vertices[i]);
-
-                if (boundEmpty)
-                {
-                    modelBound = AABox(v, v), boundEmpty = false;
-                }
-                else
-                {
-                    modelBound.merge(v);
-                }
+                modelBound.merge(v);
             }
         }
         spawn.iBound = modelBound + spawn.iPos;
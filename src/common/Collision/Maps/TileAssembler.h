@@ -21,7 +21,10 @@
 #include <G3D/Matrix3.h>
 #include <G3D/Vector3.h>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 
 #include "ModelInstance.h"
 #include "WorldModel.h"
@@ -97,9 +100,16 @@ namespace VMAP
         G3D::Table<std::string, unsigned int > iUniqueNameIds;
         MapData mapData;
         std::set<std::string> spawnedModelFiles;
+        std::mutex spawnedModelFilesLock;
+        std::unordered_map<std::string, std::shared_ptr<std::vector<G3D::Vector3> const>> iModelVertices;
+        std::mutex iModelVerticesLock;
+        uint32 iThreads;
+
+        bool convertMap(uint32 mapId, MapSpawns& spawns);
+        std::shared_ptr<std::vector<G3D::Vector3> const> getModelVertices(const std::string& pModelFilename);
 
     public:
-        TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName);
+        TileAssembler(const std::string& pSrcDirName, const std::string& pDestDirName, uint32 threads = 1);
         virtual ~TileAssembler();
 
         bool convertWorld2();
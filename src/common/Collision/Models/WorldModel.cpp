@@ -21,6 +21,11 @@
 #include "ModelInstance.h"
 #include "VMapDefinitions.h"
 
+#if !defined(__aarch64__) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define VMAP_SSE_TRIANGLE_INTERSECTION
+#include <emmintrin.h>
+#endif
+
 using G3D::Vector3;
 using G3D::Ray;
 
@@ -84,6 +89,126 @@ namespace VMAP
         return false;
     }
 
+#ifdef VMAP_SSE_TRIANGLE_INTERSECTION
+    namespace
+    {
+        // same evaluation order as G3D::Vector3::dot and cross, so every lane matches the scalar IntersectTriangle bit for bit
+        inline __m128 Dot4(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz)
+        {
+            return _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz));
+        }
+
+        inline void Cross4(__m128 ax, __m128 ay, __m128 az, __m128 bx, __m128 by, __m128 bz, __m128& rx, __m128& ry, __m128& rz)
+        {
+            rx = _mm_sub_ps(_mm_mul_ps(ay, bz), _mm_mul_ps(az, by));
+            ry = _mm_sub_ps(_mm_mul_ps(az, bx), _mm_mul_ps(ax, bz));
+            rz = _mm_sub_ps(_mm_mul_ps(ax, by), _mm_mul_ps(ay, bx));
+        }
+
+        /// Möller-Trumbore for 4 triangles at once, returns the mask of lanes hit closer than distance
+        int IntersectTriangles4(Vector3 const* const (&tri)[4][3], const Ray& ray, float distance, float (&hitDistance)[4])
+        {
+            alignas(16) float coords[3][3][4];
+            for (int lane = 0; lane < 4; ++lane)
+            {
+                for (int vertex = 0; vertex < 3; ++vertex)
+                {
+                    coords[vertex][0][lane] = tri[lane][vertex]->x;
+                    coords[vertex][1][lane] = tri[lane][vertex]->y;
+                    coords[vertex][2][lane] = tri[lane][vertex]->z;
+                }
+            }
+
+            __m128 const v0x = _mm_load_ps(coords[0][0]), v0y = _mm_load_ps(coords[0][1]), v0z = _mm_load_ps(coords[0][2]);
+            __m128 const e1x = _mm_sub_ps(_mm_load_ps(coords[1][0]), v0x);
+            __m128 const e1y = _mm_sub_ps(_mm_load_ps(coords[1][1]), v0y);
+            __m128 const e1z = _mm_sub_ps(_mm_load_ps(coords[1][2]), v0z);
+            __m128 const e2x = _mm_sub_ps(_mm_load_ps(coords[2][0]), v0x);
+            __m128 const e2y = _mm_sub_ps(_mm_load_ps(coords[2][1]), v0y);
+            __m128 const e2z = _mm_sub_ps(_mm_load_ps(coords[2][2]), v0z);
+
+            __m128 const dx = _mm_set1_ps(ray.direction().x), dy = _mm_set1_ps(ray.direction().y), dz = _mm_set1_ps(ray.direction().z);
+            __m128 const zero = _mm_setzero_ps();
+            __m128 const one = _mm_set1_ps(1.0f);
+
+            __m128 px, py, pz;
+            Cross4(dx, dy, dz, e2x, e2y, e2z, px, py, pz);
+            __m128 const a = Dot4(e1x, e1y, e1z, px, py, pz);
+            __m128 const absA = _mm_and_ps(a, _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF)));
+            __m128 const f = _mm_div_ps(one, a);
+
+            __m128 const sx = _mm_sub_ps(_mm_set1_ps(ray.origin().x), v0x);
+            __m128 const sy = _mm_sub_ps(_mm_set1_ps(ray.origin().y), v0y);
+            __m128 const sz = _mm_sub_ps(_mm_set1_ps(ray.origin().z), v0z);
+            __m128 const u = _mm_mul_ps(f, Dot4(sx, sy, sz, px, py, pz));
+
+            __m128 qx, qy, qz;
+            Cross4(sx, sy, sz, e1x, e1y, e1z, qx, qy, qz);
+            __m128 const v = _mm_mul_ps(f, Dot4(dx, dy, dz, qx, qy, qz));
+            __m128 const t = _mm_mul_ps(f, Dot4(e2x, e2y, e2z, qx, qy, qz));
+
+            // negated compares keep the scalar behaviour for NaN lanes
+            __m128 valid = _mm_cmpnlt_ps(absA, _mm_set1_ps(1e-5f));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpnlt_ps(u, zero), _mm_cmpngt_ps(u, one)));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpnlt_ps(v, zero), _mm_cmpngt_ps(_mm_add_ps(u, v), one)));
+            valid = _mm_and_ps(valid, _mm_and_ps(_mm_cmpgt_ps(t, zero), _mm_cmplt_ps(t, _mm_set1_ps(distance))));
+
+            _mm_storeu_ps(hitDistance, t);
+            return _mm_movemask_ps(valid);
+        }
+    }
+#endif
+
+    bool IntersectTriangles(std::vector<MeshTriangle>::const_iterator triangles, uint32 const* indices, uint32 count,
+        std::vector<Vector3>::const_iterator points, const Ray& ray, float& distance, bool stopAtFirstHit)
+    {
+        bool hit = false;
+#ifdef VMAP_SSE_TRIANGLE_INTERSECTION
+        Vector3 const* tri[4][3];
+        float hitDistance[4];
+        for (uint32 first = 0; first < count; first += 4)
+        {
+            uint32 lanes = std::min<uint32>(count - first, 4);
+            for (uint32 lane = 0; lane < 4; ++lane)
+            {
+                // unused lanes repeat the first triangle and are masked out below
+                MeshTriangle const& triangle = triangles[indices[first + (lane < lanes ? lane : 0)]];
+                tri[lane][0] = &points[triangle.idx0];
+                tri[lane][1] = &points[triangle.idx1];
+                tri[lane][2] = &points[triangle.idx2];
+            }
+
+            int mask = IntersectTriangles4(tri, ray, distance, hitDistance) & ((1 << lanes) - 1);
+            for (uint32 lane = 0; mask; ++lane, mask >>= 1)
+            {
+                // lanes were tested against the distance at batch start, re-check in order like the scalar loop
+                if ((mask & 1) && hitDistance[lane] < distance)
+                {
+                    distance = hitDistance[lane];
+                    hit = true;
+                    if (stopAtFirstHit)
+                    {
+                        return true;
+                    }
+                }
+            }
+        }
+#else
+        for (uint32 i = 0; i < count; ++i)
+        {
+            if (IntersectTriangle(triangles[indices[i]], points, ray, distance))
+            {
+                hit = true;
+                if (stopAtFirstHit)
+                {
+                    return true;
+                }
+            }
+        }
+#endif
+        return hit;
+    }
+
     class TriBoundFunc
     {
     public:
@@ -434,6 +559,12 @@ namespace VMAP
             if (result) { hit = true; }
             return hit;
         }
+        bool operator()(const G3D::Ray& ray, uint32 const* entries, uint32 count, float& distance, bool stopAtFirstHit)
+        {
+            bool result = IntersectTriangles(triangles, entries, count, vertices, ray, distance, stopAtFirstHit);
+            if (result) { hit = true; }
+            return hit;
+        }
         std::vector<Vector3>::const_iterator vertices;
         std::vector<MeshTriangle>::const_iterator triangles;
         bool hit;
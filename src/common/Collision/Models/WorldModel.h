@@ -42,6 +42,13 @@ namespace VMAP
         uint32 idx2{0};
     };
 
+    bool IntersectTriangle(const MeshTriangle& tri, std::vector<G3D::Vector3>::const_iterator points, const G3D::Ray& ray, float& distance);
+
+    //! Tests the triangles selected by indices against the ray, several at once where SIMD is available.
+    //! Results are identical to calling IntersectTriangle for each of them in order.
+    bool IntersectTriangles(std::vector<MeshTriangle>::const_iterator triangles, uint32 const* indices, uint32 count,
+        std::vector<G3D::Vector3>::const_iterator points, const G3D::Ray& ray, float& distance, bool stopAtFirstHit);
+
     class WmoLiquid
     {
     public:
@@ -20,16 +20,29 @@
 #include <stdio.h>
 #include <string.h>
 
-DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr) { }
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
-bool DBCFileLoader::Load(char const* filename, char const* fmt)
+DBCFileLoader::DBCFileLoader() : recordSize(0), recordCount(0), fieldCount(0), stringSize(0), fieldsOffset(nullptr), data(nullptr), stringTable(nullptr),
+    mapping(nullptr), mappingSize(0) { }
+
+bool DBCFileLoader::Load(char const* filename, char const* fmt, bool mapFile)
 {
     uint32 header;
-    if (data)
+    Unload();
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    if (mapFile)
     {
-        delete [] data;
-        data = nullptr;
+        return MapFile(filename, fmt);
     }
+#else
+    (void)mapFile;
+#endif
 
     FILE* f = fopen(filename, "rb");
     if (!f)
@@ -83,6 +96,83 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
 
     EndianConvert(stringSize);
 
+    InitFieldOffsets(fmt);
+
+    data = new unsigned char[recordSize * recordCount + stringSize];
+    stringTable = data + recordSize * recordCount;
+
+    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
+    {
+        fclose(f);
+        return false;
+    }
+
+    fclose(f);
+
+    return true;
+}
+
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+bool DBCFileLoader::MapFile(char const* filename, char const* fmt)
+{
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0 || std::size_t(fileStat.st_size) < 5 * sizeof(uint32))
+    {
+        close(fd);
+        return false;
+    }
+
+    // private mapping, so the few entries the core patches after loading get their own copy of the page
+    void* view = mmap(nullptr, fileStat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED)
+    {
+        return false;
+    }
+
+    mapping = view;
+    mappingSize = fileStat.st_size;
+
+    uint32 header[5];
+    memcpy(header, mapping, sizeof(header));
+    for (uint32& value : header)
+    {
+        EndianConvert(value);
+    }
+
+    recordCount = header[1];
+    fieldCount = header[2];
+    recordSize = header[3];
+    stringSize = header[4];
+
+    if (header[0] != 0x43424457 ||                                                              //'WDBC'
+        sizeof(header) + uint64(recordSize) * recordCount + stringSize > mappingSize)
+    {
+        Unload();
+        return false;
+    }
+
+    InitFieldOffsets(fmt);
+
+    data = static_cast<unsigned char*>(mapping) + sizeof(header);
+    stringTable = data + recordSize * recordCount;
+    return true;
+}
+#else
+bool DBCFileLoader::MapFile(char const* /*filename*/, char const* /*fmt*/)
+{
+    return false;
+}
+#endif
+
+void DBCFileLoader::InitFieldOffsets(char const* fmt)
+{
     fieldsOffset = new uint32[fieldCount];
     fieldsOffset[0] = 0;
 
@@ -98,26 +188,56 @@ bool DBCFileLoader::Load(char const* filename, char const* fmt)
             fieldsOffset[i] += sizeof(uint32);
         }
     }
+}
 
-    data = new unsigned char[recordSize * recordCount + stringSize];
-    stringTable = data + recordSize * recordCount;
-
-    if (fread(data, recordSize * recordCount + stringSize, 1, f) != 1)
+void DBCFileLoader::Unload()
+{
+#if AC_PLATFORM != AC_PLATFORM_WINDOWS
+    if (mapping)
     {
-        fclose(f);
-        return false;
+        munmap(mapping, mappingSize);
+    }
+    else
+#endif
+    {
+        delete[] data;
     }
 
-    fclose(f);
+    delete[] fieldsOffset;
 
-    return true;
+    mapping = nullptr;
+    mappingSize = 0;
+    data = nullptr;
+    stringTable = nullptr;
+    fieldsOffset = nullptr;
 }
 
 DBCFileLoader::~DBCFileLoader()
 {
-    delete[] data;
+    Unload();
+}
 
-    delete[] fieldsOffset;
+bool DBCFileLoader::CanUseInPlace(char const* fmt) const
+{
+#if ACORE_ENDIAN == ACORE_BIGENDIAN
+    (void)fmt;
+    return false;
+#else
+    if (!mapping || strlen(fmt) != fieldCount)
+    {
+        return false;
+    }
+
+    for (char const* field = fmt; *field; ++field)
+    {
+        if (*field != FT_IND && *field != FT_INT && *field != FT_FLOAT)
+        {
+            return false;
+        }
+    }
+
+    return GetFormatRecordSize(fmt) == recordSize;
+#endif
 }
 
 DBCFileLoader::Record DBCFileLoader::getRecord(std::size_t id)
@@ -221,6 +341,17 @@ char* DBCFileLoader::AutoProduceData(char const* format, uint32& records, char**
         indexTable = new ptr[recordCount];
     }
 
+    if (CanUseInPlace(format))
+    {
+        for (uint32 y = 0; y < recordCount; ++y)
+        {
+            char* record = reinterpret_cast<char*>(data + y * recordSize);
+            indexTable[i >= 0 ? getRecord(y).getUInt(i) : y] = record;
+        }
+
+        return reinterpret_cast<char*>(data);
+    }
+
     char* dataTable = new char[recordCount * recordsize];
 
     uint32 offset = 0;
@@ -281,8 +412,15 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
         return nullptr;
     }
 
-    char* stringPool = new char[stringSize];
-    memcpy(stringPool, stringTable, stringSize);
+    // strings of a mapped file stay where they are
+    char* stringPool = nullptr;
+    char* strings = reinterpret_cast<char*>(stringTable);
+    if (!mapping)
+    {
+        stringPool = new char[stringSize];
+        memcpy(stringPool, stringTable, stringSize);
+        strings = stringPool;
+    }
 
     uint32 offset = 0;
 
@@ -309,7 +447,7 @@ char* DBCFileLoader::AutoProduceStrings(char const* format, char* dataTable)
                     if (!*slot || !** slot)
                     {
                         const char* st = getRecord(y).getString(x);
-                        *slot = stringPool + (st - (char const*)stringTable);
+                        *slot = strings + (st - (char const*)stringTable);
                     }
                     offset += sizeof(char*);
                     break;
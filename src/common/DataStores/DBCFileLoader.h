@@ -41,7 +41,12 @@ public:
     DBCFileLoader();
     ~DBCFileLoader();
 
-    bool Load(const char* filename, const char* fmt);
+    /**
+     * @param mapFile map the file copy-on-write instead of reading it. Records and strings of a mapped file
+     *                can be referenced in place, the loader must then outlive everything pointing into it.
+     *                Falls back to reading the file on platforms without mmap.
+     */
+    bool Load(const char* filename, const char* fmt, bool mapFile = false);
 
     class Record
     {
@@ -92,11 +97,22 @@ public:
     [[nodiscard]] uint32 GetCols() const { return fieldCount; }
     [[nodiscard]] uint32 GetOffset(std::size_t id) const { return (fieldsOffset != nullptr && id < fieldCount) ? fieldsOffset[id] : 0; }
     [[nodiscard]] bool IsLoaded() const { return data != nullptr; }
+    [[nodiscard]] bool IsMapped() const { return mapping != nullptr; }
+    [[nodiscard]] std::size_t GetMappedSize() const { return mappingSize; }
+    [[nodiscard]] uint32 GetStringSize() const { return stringSize; }
+    // the records of a mapped file already have the layout of the C++ structure: only 4 byte numeric fields, nothing skipped
+    [[nodiscard]] bool CanUseInPlace(char const* fmt) const;
+    // returns the mapped records themselves if CanUseInPlace, a new copy otherwise
     char* AutoProduceData(char const* fmt, uint32& count, char**& indexTable);
+    // returns the new string pool, or nullptr if the strings of a mapped file are referenced in place
     char* AutoProduceStrings(char const* fmt, char* dataTable);
     static uint32 GetFormatRecordSize(const char* format, int32* index_pos = nullptr);
 
 private:
+    bool MapFile(char const* filename, char const* fmt);
+    void InitFieldOffsets(char const* fmt);
+    void Unload();
+
     uint32 recordSize;
     uint32 recordCount;
     uint32 fieldCount;
@@ -104,6 +120,8 @@ private:
     uint32* fieldsOffset;
     unsigned char* data;
     unsigned char* stringTable;
+    void* mapping;
+    std::size_t mappingSize;
 
     DBCFileLoader(DBCFileLoader const& right) = delete;
     DBCFileLoader& operator=(DBCFileLoader const& right) = delete;
@@ -17,6 +17,7 @@
 
 #include "EventMap.h"
 #include "Random.h"
+#include <algorithm>
 
 void EventMap::Reset()
 {
@@ -65,7 +66,7 @@ void EventMap::ScheduleEvent(uint32 eventId, uint32 time, uint32 group /*= 0*/,
         eventId |= (1 << (phase + 23));
     }
 
-    _eventMap.emplace(_time + time, eventId);
+    InsertEvent(_time + time, eventId);
 }
 
 void EventMap::ScheduleEvent(uint32 eventId, Milliseconds time, uint32 group /*= 0*/, uint8 phase /* = 0*/)
@@ -98,7 +99,7 @@ void EventMap::RescheduleEvent(uint32 eventId, Milliseconds minTime, Millisecond
 
 void EventMap::RepeatEvent(uint32 time)
 {
-    _eventMap.emplace(_time + time, _lastEvent);
+    InsertEvent(_time + time, _lastEvent);
 }
 
 void EventMap::Repeat(Milliseconds time)
@@ -115,21 +116,21 @@ uint32 EventMap::ExecuteEvent()
 {
     while (!Empty())
     {
-        auto const& itr = _eventMap.begin();
+        auto const& event = _eventMap.back();
 
-        if (itr->first > _time)
+        if (event.first > _time)
         {
             return 0;
         }
-        else if (_phase && (itr->second & 0xFF000000) && !((itr->second >> 24) & _phase))
+        else if (_phase && (event.second & 0xFF000000) && !((event.second >> 24) & _phase))
         {
-            _eventMap.erase(itr);
+            _eventMap.pop_back();
         }
         else
         {
-            uint32 eventId = (itr->second & 0x0000FFFF);
-            _lastEvent = itr->second;
-            _eventMap.erase(itr);
+            uint32 eventId = (event.second & 0x0000FFFF);
+            _lastEvent = event.second;
+            _eventMap.pop_back();
             return eventId;
         }
     }
@@ -156,35 +157,41 @@ void EventMap::DelayEvents(uint32 delay, uint32 group)
 
     EventStore delayed;
 
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
-    {
+    // collect in execution order, the delayed events keep their order among each other
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
         if (!group || (itr->second & (1 << (group + 15))))
-        {
-            delayed.insert(EventStore::value_type(itr->first + delay, itr->second));
-            itr = _eventMap.erase(itr);
-            continue;
-        }
+            delayed.emplace_back(itr->first + delay, itr->second);
 
-        ++itr;
+    if (delayed.empty())
+    {
+        return;
     }
 
-    _eventMap.insert(delayed.begin(), delayed.end());
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [group](EventStore::value_type const& event)
+    {
+        return !group || (event.second & (1 << (group + 15)));
+    }), _eventMap.end());
+
+    for (EventStore::value_type const& event : delayed)
+        InsertEvent(event.first, event.second);
 }
 
 void EventMap::DelayEventsToMax(uint32 delay, uint32 group)
 {
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    auto const isDelayed = [this, delay, group](EventStore::value_type const& event)
     {
-        if (itr->first < _time + delay && (group == 0 || ((1 << (group + 15)) & itr->second)))
-        {
-            ScheduleEvent(itr->second, delay);
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
+        return event.first < _time + delay && (group == 0 || ((1 << (group + 15)) & event.second));
+    };
 
-        ++itr;
-    }
+    EventStore delayed;
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (isDelayed(*itr))
+            delayed.push_back(*itr);
+
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), isDelayed), _eventMap.end());
+
+    for (EventStore::value_type const& event : delayed)
+        ScheduleEvent(event.second, delay);
 }
 
 void EventMap::CancelEvent(uint32 eventId)
@@ -194,16 +201,10 @@ void EventMap::CancelEvent(uint32 eventId)
         return;
     }
 
-    for (auto itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [eventId](EventStore::value_type const& event)
     {
-        if (eventId == (itr->second & 0x0000FFFF))
-        {
-            itr = _eventMap.erase(itr);
-            continue;
-        }
-
-        ++itr;
-    }
+        return eventId == (event.second & 0x0000FFFF);
+    }), _eventMap.end());
 }
 
 void EventMap::CancelEventGroup(uint32 group)
@@ -214,17 +215,10 @@ void EventMap::CancelEventGroup(uint32 group)
     }
 
     uint32 groupMask = (1 << (group + 15));
-    for (EventStore::iterator itr = _eventMap.begin(); itr != _eventMap.end();)
+    _eventMap.erase(std::remove_if(_eventMap.begin(), _eventMap.end(), [groupMask](EventStore::value_type const& event)
     {
-        if (itr->second & groupMask)
-        {
-            _eventMap.erase(itr);
-            itr = _eventMap.begin();
-            continue;
-        }
-
-        ++itr;
-    }
+        return event.second & groupMask;
+    }), _eventMap.end());
 }
 
 uint32 EventMap::GetNextEventTime(uint32 eventId) const
@@ -234,11 +228,11 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
         return 0;
     }
 
-    for (auto const& itr : _eventMap)
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
     {
-        if (eventId == (itr.second & 0x0000FFFF))
+        if (eventId == (itr->second & 0x0000FFFF))
         {
-            return itr.first;
+            return itr->first;
         }
     }
 
@@ -247,7 +241,7 @@ uint32 EventMap::GetNextEventTime(uint32 eventId) const
 
 uint32 EventMap::GetNextEventTime() const
 {
-    return Empty() ? 0 : _eventMap.begin()->first;
+    return Empty() ? 0 : _eventMap.back().first;
 }
 
 bool EventMap::IsInPhase(uint8 phase)
@@ -257,9 +251,20 @@ bool EventMap::IsInPhase(uint8 phase)
 
 Milliseconds EventMap::GetTimeUntilEvent(uint32 eventId) const
 {
-    for (std::pair<uint32 const, uint32> const& itr : _eventMap)
-        if (eventId == (itr.second & 0x0000FFFF))
-            return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr.first) - Milliseconds(_time));
+    for (auto itr = _eventMap.rbegin(); itr != _eventMap.rend(); ++itr)
+        if (eventId == (itr->second & 0x0000FFFF))
+            return std::chrono::duration_cast<Milliseconds>(Milliseconds(itr->first) - Milliseconds(_time));
 
     return Milliseconds::max();
 }
+
+void EventMap::InsertEvent(uint32 time, uint32 eventData)
+{
+    // in front of the events with the same time, they are executed first
+    auto itr = std::lower_bound(_eventMap.begin(), _eventMap.end(), time, [](EventStore::value_type const& event, uint32 eventTime)
+    {
+        return event.first > eventTime;
+    });
+
+    _eventMap.emplace(itr, time, eventData);
+}
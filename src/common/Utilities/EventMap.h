@@ -20,22 +20,28 @@
 
 #include "Define.h"
 #include "Duration.h"
-#include <map>
+#include <boost/container/small_vector.hpp>
 
 class EventMap
 {
     /**
     * Internal storage type.
-    * Key: Time as TimePoint when the event should occur.
-    * Value: The event data as uint32.
+    * First: Time as TimePoint when the event should occur.
+    * Second: The event data as uint32.
     *
     * Structure of event data:
     * - Bit  0 - 15: Event Id.
     * - Bit 16 - 23: Group
     * - Bit 24 - 31: Phase
     * - Pattern: 0xPPGGEEEE
+    *
+    * Sorted by descending time, the next event to execute is the last element.
+    * Events with the same time execute in the order they were scheduled.
+    * The events of most scripts fit into the inline capacity, so scheduling
+    * and executing events does not allocate.
     */
-    typedef std::multimap<uint32, uint32> EventStore;
+    static constexpr std::size_t EVENT_MAP_INLINE_CAPACITY = 8;
+    typedef boost::container::small_vector<std::pair<uint32, uint32>, EVENT_MAP_INLINE_CAPACITY> EventStore;
 
 public:
     EventMap() { }
@@ -286,6 +292,14 @@ public:
     Milliseconds GetTimeUntilEvent(uint32 eventId) const;
 
 private:
+    /**
+    * @name InsertEvent
+    * @brief Inserts the event data behind all events of the same time.
+    * @param time Time when the event should occur.
+    * @param eventData Event id, group and phase of the event.
+    */
+    void InsertEvent(uint32 time, uint32 eventData);
+
     /**
     * @name _time
     * @brief Internal timer.
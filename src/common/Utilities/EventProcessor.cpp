@@ -17,6 +17,11 @@
 
 #include "EventProcessor.h"
 #include "Errors.h"
+#include "ObjectPool.h"
+#include <algorithm>
+#include <bit>
+#include <limits>
+#include <utility>
 
 void BasicEvent::ScheduleAbort()
 {
@@ -32,6 +37,38 @@ void BasicEvent::SetAborted()
     m_abortState = AbortState::STATE_ABORTED;
 }
 
+namespace
+{
+    // sized for the usual captures (this, a few guids and values), bigger lambdas fall back to the heap
+    constexpr std::size_t LAMBDA_EVENT_POOL_BLOCK_SIZE = 128;
+
+    Acore::ObjectPool& GetLambdaEventPool()
+    {
+        static Acore::ObjectPool& pool = Acore::ObjectPool::Create("LambdaBasicEvent", LAMBDA_EVENT_POOL_BLOCK_SIZE);
+        return pool;
+    }
+
+    constexpr uint64 GetLevelShift(uint32 level)
+    {
+        return uint64(level) * EventProcessor::EVENT_WHEEL_BITS;
+    }
+
+    constexpr uint32 GetLevelIndex(uint64 time, uint32 level)
+    {
+        return uint32(time >> GetLevelShift(level)) & (EventProcessor::EVENT_WHEEL_SLOTS - 1);
+    }
+}
+
+void* AllocateLambdaEvent(std::size_t size)
+{
+    return GetLambdaEventPool().Allocate(size);
+}
+
+void FreeLambdaEvent(void* ptr, std::size_t size)
+{
+    GetLambdaEventPool().Deallocate(ptr, size);
+}
+
 EventProcessor::~EventProcessor()
 {
     KillAllEvents(true);
@@ -42,13 +79,37 @@ void EventProcessor::Update(uint32 p_time)
     // update time
     m_time += p_time;
 
-    // main event loop
-    EventList::iterator i;
-    while (((i = m_events.begin()) != m_events.end()) && i->first <= m_time)
+    // nothing due, the wheel position is only moved once there is something to execute
+    if (m_nextEventTime > m_time)
+        return;
+
+    // main event loop, events added while executing that are due run in this update as well
+    uint64 nextTime = m_time;
+    while (m_eventCount)
     {
+        BasicEvent* event;
+        if (m_wheel)
+        {
+            if ((nextTime = GetNextWheelTime()) > m_time)
+                break;
+
+            AdvanceWheel(nextTime);
+
+            // the events of a cascaded slot may all start later than the slot
+            event = m_wheel->Slots[GetLevelIndex(m_wheelTime, 0)];
+            if (!event)
+                continue;
+        }
+        else
+        {
+            if ((nextTime = m_events->m_execTime) > m_time)
+                break;
+
+            event = m_events;
+        }
+
         // get and remove event from queue
-        BasicEvent* event = i->second;
-        m_events.erase(i);
+        Unlink(event);
 
         if (event->IsRunning())
         {
@@ -77,60 +138,43 @@ void EventProcessor::Update(uint32 p_time)
         // the next update tick
         AddEvent(event, CalculateTime(1), false, 0);
     }
+
+    m_nextEventTime = m_eventCount ? nextTime : std::numeric_limits<uint64>::max();
 }
 
 void EventProcessor::KillAllEvents(bool force)
 {
-    // first, abort all existing events
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    RemoveEventsIf([this, force](BasicEvent* event)
     {
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
         // Skip non-deletable events when we are
         // not forcing the event cancellation.
-        if (!force && !itr->second->IsDeletable())
-        {
-            ++itr;
-            continue;
-        }
-
-        delete itr->second;
-
-        if (force)
-            ++itr; // Clear the whole container when forcing
-        else
-            itr = m_events.erase(itr);
-    }
-
-    if (force)
-        m_events.clear();
+        return force || event->IsDeletable();
+    });
 }
 
 void EventProcessor::CancelEventGroup(uint8 group)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end();)
+    RemoveEventsIf([this, group](BasicEvent* event)
     {
-        if (itr->second->m_eventGroup != group)
-        {
-            ++itr;
-            continue;
-        }
+        if (event->m_eventGroup != group)
+            return false;
 
         // Abort events which weren't aborted already
-        if (!itr->second->IsAborted())
+        if (!event->IsAborted())
         {
-            itr->second->SetAborted();
-            itr->second->Abort(m_time);
+            event->SetAborted();
+            event->Abort(m_time);
         }
 
-        delete itr->second;
-        itr = m_events.erase(itr);
-    }
+        return true;
+    });
 }
 
 void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime, uint8 eventGroup)
@@ -139,21 +183,23 @@ void EventProcessor::AddEvent(BasicEvent* Event, uint64 e_time, bool set_addtime
         Event->m_addTime = m_time;
     Event->m_execTime = e_time;
     Event->m_eventGroup = eventGroup;
-    m_events.insert(std::pair<uint64, BasicEvent*>(e_time, Event));
+
+    // an empty wheel may jump to the current time, so the event does not have to cascade down from a stale position
+    if (m_wheel && !m_eventCount)
+        m_wheelTime = m_time;
+
+    Link(Event);
 }
 
 void EventProcessor::ModifyEventTime(BasicEvent* event, Milliseconds newTime)
 {
-    for (auto itr = m_events.begin(); itr != m_events.end(); ++itr)
-    {
-        if (itr->second != event)
-            continue;
+    // events not queued (executing right now) keep their time, like events of other processors
+    if (event->m_slot == BasicEvent::EVENT_SLOT_NONE)
+        return;
 
-        event->m_execTime = newTime.count();
-        m_events.erase(itr);
-        m_events.insert(std::pair<uint64, BasicEvent*>(newTime.count(), event));
-        break;
-    }
+    Unlink(event);
+    event->m_execTime = newTime.count();
+    Link(event);
 }
 
 uint64 EventProcessor::CalculateTime(uint64 t_offset) const
@@ -165,3 +211,253 @@ uint64 EventProcessor::CalculateQueueTime(uint64 delay) const
 {
     return CalculateTime(delay - (m_time % delay));
 }
+
+void EventProcessor::Link(BasicEvent* event)
+{
+    if (!m_wheel)
+    {
+        if (m_eventCount < EVENT_LIST_MAX)
+        {
+            LinkToList(event);
+            return;
+        }
+
+        CreateWheel();
+    }
+
+    // overdue events execute with the slot the wheel currently points to
+    uint64 const time = std::max(event->m_execTime, m_wheelTime);
+
+    // lowest level whose current slot range contains the time, the wheel and the event share all higher bits
+    for (uint32 level = 0; level < EVENT_WHEEL_LEVELS; ++level)
+    {
+        if ((time >> GetLevelShift(level + 1)) == (m_wheelTime >> GetLevelShift(level + 1)))
+        {
+            LinkToSlot(event, uint16(level * EVENT_WHEEL_SLOTS + GetLevelIndex(time, level)));
+
+            // the event is executed or cascaded down at the start of its slot
+            m_nextEventTime = std::min(m_nextEventTime, (time >> GetLevelShift(level)) << GetLevelShift(level));
+            return;
+        }
+    }
+
+    LinkToSlot(event, EVENT_SLOT_FAR);
+    m_nextEventTime = std::min(m_nextEventTime, ((m_wheelTime >> GetLevelShift(EVENT_WHEEL_LEVELS)) + 1) << GetLevelShift(EVENT_WHEEL_LEVELS));
+}
+
+void EventProcessor::LinkToList(BasicEvent* event)
+{
+    if (!m_events)
+    {
+        m_events = event;
+        event->m_prev = event->m_next = event;
+    }
+    else
+    {
+        uint64 const time = event->m_execTime;
+        BasicEvent* const tail = m_events->m_prev;
+
+        // search from the end closer in time, the event goes behind all events of the same time
+        BasicEvent* prev;
+        if (time - std::min(time, m_events->m_execTime) < std::max(time, tail->m_execTime) - time)
+        {
+            prev = tail;
+            for (BasicEvent* next = m_events; next->m_execTime <= time; next = next->m_next)
+                if ((prev = next) == tail)
+                    break;
+        }
+        else
+        {
+            prev = tail;
+            while (prev != m_events && prev->m_execTime > time)
+                prev = prev->m_prev;
+        }
+
+        if (prev->m_execTime > time)
+        {
+            // before the first event, the new head is linked behind the tail
+            prev = tail;
+            m_events = event;
+        }
+
+        event->m_prev = prev;
+        event->m_next = prev->m_next;
+        prev->m_next->m_prev = event;
+        prev->m_next = event;
+    }
+
+    event->m_slot = EVENT_SLOT_LIST;
+    ++m_eventCount;
+    m_nextEventTime = std::min(m_nextEventTime, event->m_execTime);
+}
+
+void EventProcessor::CreateWheel()
+{
+    m_wheel = std::make_unique<EventWheel>();
+    m_wheelTime = m_time;
+
+    BasicEvent* head = std::exchange(m_events, nullptr);
+    if (!head)
+        return;
+
+    // move the queued events over in list order, keeping the order of events with the same time
+    head->m_prev->m_next = nullptr;
+    for (BasicEvent* event = head; event;)
+    {
+        BasicEvent* next = event->m_next;
+        --m_eventCount;
+        Link(event);
+        event = next;
+    }
+}
+
+void EventProcessor::LinkToSlot(BasicEvent* event, uint16 slot)
+{
+    BasicEvent*& head = m_wheel->Slots[slot];
+    if (!head)
+    {
+        head = event;
+        event->m_prev = event->m_next = event;
+        if (slot < EVENT_SLOT_FAR)
+            m_wheel->Occupied[slot / EVENT_WHEEL_SLOTS] |= uint64(1) << (slot % EVENT_WHEEL_SLOTS);
+    }
+    else
+    {
+        // append, events of the same slot keep the order they were added in
+        BasicEvent* tail = head->m_prev;
+        tail->m_next = event;
+        event->m_prev = tail;
+        event->m_next = head;
+        head->m_prev = event;
+    }
+
+    event->m_slot = slot;
+    ++m_eventCount;
+}
+
+void EventProcessor::Unlink(BasicEvent* event)
+{
+    uint16 const slot = event->m_slot;
+    BasicEvent*& head = GetHead(slot);
+    if (event->m_next == event)
+    {
+        head = nullptr;
+        if (slot < EVENT_SLOT_FAR)
+            m_wheel->Occupied[slot / EVENT_WHEEL_SLOTS] &= ~(uint64(1) << (slot % EVENT_WHEEL_SLOTS));
+    }
+    else
+    {
+        event->m_prev->m_next = event->m_next;
+        event->m_next->m_prev = event->m_prev;
+        if (head == event)
+            head = event->m_next;
+    }
+
+    event->m_prev = event->m_next = nullptr;
+    event->m_slot = BasicEvent::EVENT_SLOT_NONE;
+    --m_eventCount;
+}
+
+uint64 EventProcessor::GetNextWheelTime() const
+{
+    // first non empty slot at or after the current position, higher levels always start later than lower ones
+    uint64 occupied = m_wheel->Occupied[0] & (~uint64(0) << GetLevelIndex(m_wheelTime, 0));
+    if (occupied)
+        return (m_wheelTime & ~uint64(EVENT_WHEEL_SLOTS - 1)) | uint64(std::countr_zero(occupied));
+
+    for (uint32 level = 1; level < EVENT_WHEEL_LEVELS; ++level)
+    {
+        // the current slot of a higher level was already cascaded down
+        uint32 const index = GetLevelIndex(m_wheelTime, level);
+        occupied = index + 1 < EVENT_WHEEL_SLOTS ? m_wheel->Occupied[level] & (~uint64(0) << (index + 1)) : 0;
+        if (occupied)
+        {
+            uint64 const blockStart = (m_wheelTime >> GetLevelShift(level + 1)) << GetLevelShift(level + 1);
+            return blockStart | (uint64(std::countr_zero(occupied)) << GetLevelShift(level));
+        }
+    }
+
+    // only events beyond the top level left, recheck them when the top level wraps
+    return ((m_wheelTime >> GetLevelShift(EVENT_WHEEL_LEVELS)) + 1) << GetLevelShift(EVENT_WHEEL_LEVELS);
+}
+
+void EventProcessor::AdvanceWheel(uint64 time)
+{
+    if (time == m_wheelTime)
+        return;
+
+    // the slots passed on the way are empty, see GetNextWheelTime()
+    m_wheelTime = time;
+
+    // move the events of every slot starting now one or more levels down, highest level first
+    if (!(time & ((uint64(1) << GetLevelShift(EVENT_WHEEL_LEVELS)) - 1)))
+        Cascade(EVENT_SLOT_FAR);
+
+    for (uint32 level = EVENT_WHEEL_LEVELS - 1; level > 0; --level)
+        if (!(time & ((uint64(1) << GetLevelShift(level)) - 1)))
+            Cascade(uint16(level * EVENT_WHEEL_SLOTS + GetLevelIndex(time, level)));
+}
+
+void EventProcessor::Cascade(uint16 slot)
+{
+    BasicEvent* head = m_wheel->Slots[slot];
+    if (!head)
+        return;
+
+    m_wheel->Slots[slot] = nullptr;
+    if (slot < EVENT_SLOT_FAR)
+        m_wheel->Occupied[slot / EVENT_WHEEL_SLOTS] &= ~(uint64(1) << (slot % EVENT_WHEEL_SLOTS));
+
+    // relink in list order, keeping the insertion order of events with the same time
+    BasicEvent* event = head;
+    do
+    {
+        BasicEvent* next = event->m_next;
+        --m_eventCount;
+        Link(event);
+        event = next;
+    } while (event != head);
+}
+
+template<typename Predicate>
+void EventProcessor::RemoveEventsIf(Predicate&& predicate)
+{
+    if (!m_eventCount)
+        return;
+
+    if (!m_wheel)
+    {
+        RemoveEventsIf(EVENT_SLOT_LIST, predicate);
+        return;
+    }
+
+    // kept events are linked back into the same or a lower slot, which is not visited again
+    for (uint16 slot = 0; slot <= EVENT_SLOT_FAR; ++slot)
+        if (m_wheel->Slots[slot])
+            RemoveEventsIf(slot, predicate);
+}
+
+template<typename Predicate>
+void EventProcessor::RemoveEventsIf(uint16 slot, Predicate& predicate)
+{
+    // detach the slot, the predicate may add events or switch the processor to the wheel
+    BasicEvent* head = std::exchange(GetHead(slot), nullptr);
+    if (slot < EVENT_SLOT_FAR)
+        m_wheel->Occupied[slot / EVENT_WHEEL_SLOTS] &= ~(uint64(1) << (slot % EVENT_WHEEL_SLOTS));
+
+    head->m_prev->m_next = nullptr;
+    for (BasicEvent* event = head; event;)
+    {
+        BasicEvent* next = event->m_next;
+        event->m_prev = event->m_next = nullptr;
+        event->m_slot = BasicEvent::EVENT_SLOT_NONE;
+        --m_eventCount;
+
+        if (predicate(event))
+            delete event;
+        else
+            Link(event);
+
+        event = next;
+    }
+}
@@ -21,7 +21,10 @@
 #include "Define.h"
 #include "Duration.h"
 #include "Random.h"
+#include <array>
+#include <limits>
 #include <map>
+#include <memory>
 
 class EventProcessor;
 
@@ -68,14 +71,27 @@ class BasicEvent
         uint64 m_addTime{0};                                   // time when the event was added to queue, filled by event handler
         uint64 m_execTime{0};                                  // planned time of next execution, filled by event handler
         uint8 m_eventGroup{0};
+
+        // position in the event list or timing wheel of the owning EventProcessor, m_slot is EVENT_SLOT_NONE while not queued
+        static constexpr uint16 EVENT_SLOT_NONE = 0xFFFF;
+        BasicEvent* m_prev{nullptr};
+        BasicEvent* m_next{nullptr};
+        uint16 m_slot{EVENT_SLOT_NONE};
 };
 
+AC_COMMON_API void* AllocateLambdaEvent(std::size_t size);
+AC_COMMON_API void FreeLambdaEvent(void* ptr, std::size_t size);
+
 template<typename T>
 class LambdaBasicEvent : public BasicEvent
 {
     public:
         LambdaBasicEvent(T&& callback) : BasicEvent(), _callback(std::move(callback)) { }
 
+        // small lambdas share a pool instead of a heap allocation each
+        static void* operator new(std::size_t size) { return AllocateLambdaEvent(size); }
+        static void operator delete(void* ptr, std::size_t size) { FreeLambdaEvent(ptr, size); }
+
         bool Execute(uint64, uint32) override
         {
             _callback();
@@ -90,11 +106,23 @@ class LambdaBasicEvent : public BasicEvent
 template<typename T>
 using is_lambda_event = std::enable_if_t<!std::is_base_of_v<BasicEvent, std::remove_pointer_t<std::remove_cvref_t<T>>>>;
 
-typedef std::multimap<uint64, BasicEvent*> EventList;
-
+/**
+ * Most processors only ever queue a few events, those are kept in an intrusive list sorted by execution time.
+ *
+ * Once more than EVENT_LIST_MAX events are queued the processor switches to a hierarchical timing wheel and keeps it:
+ * EVENT_WHEEL_LEVELS levels of EVENT_WHEEL_SLOTS slots, a slot of level n covering EVENT_WHEEL_SLOTS^n milliseconds.
+ * An event is linked into the lowest level whose current slot range still contains its execution time and moves down
+ * a level whenever the processor time reaches the start of its slot, so adding, cancelling and rescheduling an event
+ * is O(1). In both modes events of the same execution time execute in the order they were added.
+ */
 class EventProcessor
 {
     public:
+        static constexpr uint32 EVENT_WHEEL_BITS = 6;
+        static constexpr uint32 EVENT_WHEEL_SLOTS = 1 << EVENT_WHEEL_BITS;
+        static constexpr uint32 EVENT_WHEEL_LEVELS = 6;
+        static constexpr std::size_t EVENT_LIST_MAX = 32;
+
         EventProcessor()  = default;
         ~EventProcessor();
 
@@ -124,8 +152,37 @@ class EventProcessor
 
     protected:
         uint64 m_time{0};
-        EventList m_events;
         bool m_aborting;
+
+    private:
+        static constexpr uint16 EVENT_SLOT_FAR = EVENT_WHEEL_LEVELS * EVENT_WHEEL_SLOTS; // beyond the range of the top level
+        static constexpr uint16 EVENT_SLOT_LIST = EVENT_SLOT_FAR + 1;                     // m_events, the processor has no wheel
+
+        struct EventWheel
+        {
+            std::array<BasicEvent*, EVENT_WHEEL_LEVELS * EVENT_WHEEL_SLOTS + 1> Slots{}; // heads of circular lists
+            std::array<uint64, EVENT_WHEEL_LEVELS> Occupied{};                           // non empty slots of each level
+        };
+
+        [[nodiscard]] BasicEvent*& GetHead(uint16 slot) { return slot == EVENT_SLOT_LIST ? m_events : m_wheel->Slots[slot]; }
+        void Link(BasicEvent* event);
+        void Unlink(BasicEvent* event);
+        void LinkToList(BasicEvent* event);
+        void LinkToSlot(BasicEvent* event, uint16 slot);
+        void CreateWheel();
+        [[nodiscard]] uint64 GetNextWheelTime() const;
+        void AdvanceWheel(uint64 time);
+        void Cascade(uint16 slot);
+        template<typename Predicate>
+        void RemoveEventsIf(Predicate&& predicate);
+        template<typename Predicate>
+        void RemoveEventsIf(uint16 slot, Predicate& predicate);
+
+        BasicEvent* m_events{nullptr};                         // sorted by execution time, only used while there is no wheel
+        std::unique_ptr<EventWheel> m_wheel;
+        uint64 m_wheelTime{0};                                 // all events queued in the wheel execute at or after this time
+        uint64 m_nextEventTime{std::numeric_limits<uint64>::max()}; // nothing needs to be processed before this time
+        std::size_t m_eventCount{0};
 };
 
 #endif
@@ -0,0 +1,180 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ObjectPool.h"
+#include "Errors.h"
+#include <algorithm>
+#include <array>
+#include <new>
+
+namespace
+{
+    std::mutex _poolRegistryLock;
+    std::array<std::atomic<Acore::ObjectPool*>, Acore::ObjectPool::MAX_POOLS> _pools = { };
+    std::size_t _poolCount = 0;
+
+    constexpr std::size_t RoundUpBlockSize(std::size_t size)
+    {
+        constexpr std::size_t alignment = alignof(std::max_align_t);
+        return (size + alignment - 1) / alignment * alignment;
+    }
+}
+
+namespace
+{
+    /// Free blocks of every pool cached by a thread. Trivially destructible, so it can still be used by destructors that
+    /// run after the thread local objects of the thread, like the static destructors of the main thread
+    struct ObjectPoolThreadState
+    {
+        std::array<Acore::ObjectPoolFreeList, Acore::ObjectPool::MAX_POOLS> Caches;
+        bool Registered = false;
+        bool Exited = false;
+    };
+
+    thread_local ObjectPoolThreadState _threadState;
+}
+
+namespace Acore
+{
+    /// Gives the cached blocks back to the pools when the thread exits, the thread uses the shared free lists afterwards
+    struct ObjectPoolThreadGuard
+    {
+        ~ObjectPoolThreadGuard()
+        {
+            for (std::size_t i = 0; i < ObjectPool::MAX_POOLS; ++i)
+                if (_threadState.Caches[i].Count)
+                    if (ObjectPool* pool = _pools[i].load(std::memory_order_acquire))
+                        pool->Flush(_threadState.Caches[i], _threadState.Caches[i].Count);
+
+            _threadState.Exited = true;
+        }
+    };
+}
+
+namespace
+{
+    /// Returns nullptr once the thread local objects of the thread were destroyed
+    Acore::ObjectPoolFreeList* GetThreadCache(std::size_t index)
+    {
+        if (!_threadState.Registered)
+        {
+            _threadState.Registered = true;
+            thread_local Acore::ObjectPoolThreadGuard guard;
+            (void)guard;
+        }
+
+        return _threadState.Exited ? nullptr : &_threadState.Caches[index];
+    }
+}
+
+Acore::ObjectPool& Acore::ObjectPool::Create(char const* name, std::size_t blockSize)
+{
+    std::lock_guard<std::mutex> guard(_poolRegistryLock);
+    if (_poolCount >= MAX_POOLS)
+        ABORT("Too many object pools, raise ObjectPool::MAX_POOLS");
+
+    ObjectPool* pool = new ObjectPool(_poolCount, name, blockSize);
+    _pools[_poolCount++].store(pool, std::memory_order_release);
+    return *pool;
+}
+
+void Acore::ObjectPool::ForEach(std::function<void(ObjectPool const&)> const& visitor)
+{
+    for (std::atomic<ObjectPool*> const& pool : _pools)
+        if (ObjectPool const* p = pool.load(std::memory_order_acquire))
+            visitor(*p);
+}
+
+Acore::ObjectPool::ObjectPool(std::size_t index, char const* name, std::size_t blockSize) :
+    _index(index), _name(name), _blockSize(RoundUpBlockSize(blockSize)),
+    _blocksPerSlab(std::max<std::size_t>(POOL_SLAB_SIZE / _blockSize, 16)),
+    _batchSize(std::clamp<std::size_t>(_blocksPerSlab / 4, 4, 64)),
+    _blocksInUse(0), _blockCapacity(0)
+{
+}
+
+void* Acore::ObjectPool::Allocate(std::size_t size)
+{
+    if (size > _blockSize)
+        return ::operator new(size);
+
+    _blocksInUse.fetch_add(1, std::memory_order_relaxed);
+
+    ObjectPoolFreeList* cache = GetThreadCache(_index);
+    if (!cache)
+    {
+        ObjectPoolFreeList single;
+        Refill(single, 1);
+        return single.Pop();
+    }
+
+    if (!cache->Count)
+        Refill(*cache, _batchSize);
+
+    return cache->Pop();
+}
+
+void Acore::ObjectPool::Deallocate(void* ptr, std::size_t size)
+{
+    if (!ptr)
+        return;
+
+    if (size > _blockSize)
+    {
+        ::operator delete(ptr);
+        return;
+    }
+
+    _blocksInUse.fetch_sub(1, std::memory_order_relaxed);
+
+    ObjectPoolFreeList* cache = GetThreadCache(_index);
+    if (!cache)
+    {
+        ObjectPoolFreeList single;
+        single.Push(ptr);
+        Flush(single, 1);
+        return;
+    }
+
+    // threads that mostly free blocks allocated elsewhere (packets received by the network threads) hand them back in batches
+    cache->Push(ptr);
+    if (cache->Count >= _batchSize * 2)
+        Flush(*cache, _batchSize);
+}
+
+void Acore::ObjectPool::Refill(ObjectPoolFreeList& cache, std::size_t count)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    if (!_freeBlocks.Count)
+    {
+        char* slab = static_cast<char*>(::operator new(_blockSize * _blocksPerSlab));
+        for (std::size_t i = _blocksPerSlab; i > 0; --i)
+            _freeBlocks.Push(slab + (i - 1) * _blockSize);
+
+        _blockCapacity.fetch_add(_blocksPerSlab, std::memory_order_relaxed);
+    }
+
+    for (count = std::min(count, _freeBlocks.Count); count > 0; --count)
+        cache.Push(_freeBlocks.Pop());
+}
+
+void Acore::ObjectPool::Flush(ObjectPoolFreeList& cache, std::size_t count)
+{
+    std::lock_guard<std::mutex> guard(_lock);
+    for (; count > 0; --count)
+        _freeBlocks.Push(cache.Pop());
+}
@@ -0,0 +1,107 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _OBJECT_POOL_H
+#define _OBJECT_POOL_H
+
+#include "Define.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+
+namespace Acore
+{
+    /// Intrusive list of free blocks, trivially destructible so thread caches stay usable until the thread is gone
+    struct ObjectPoolFreeList
+    {
+        struct Block
+        {
+            Block* Next;
+        };
+
+        Block* Head = nullptr;
+        std::size_t Count = 0;
+
+        void Push(void* ptr)
+        {
+            Block* block = static_cast<Block*>(ptr);
+            block->Next = Head;
+            Head = block;
+            ++Count;
+        }
+
+        void* Pop()
+        {
+            Block* block = Head;
+            Head = block->Next;
+            --Count;
+            return block;
+        }
+    };
+
+    /**
+     * @brief Free list pool of fixed size blocks for the class specific operator new/delete of frequently allocated objects.
+     *
+     * Blocks are carved from slabs of about POOL_SLAB_SIZE bytes and never returned to the system. Every thread keeps a
+     * small cache of free blocks and exchanges them in batches with the shared free list, so objects may be freed on
+     * another thread than the one that allocated them. Once the thread local objects of a thread are destroyed (static
+     * destructors of the main thread), its cache is flushed and the thread uses the shared free list directly. Requests
+     * larger than the block size are passed to the global operator new, the sized operator delete sends them back there.
+     *
+     * Pools are created once and live until the process exits, see ObjectPool::Create().
+     */
+    class AC_COMMON_API ObjectPool
+    {
+    public:
+        static constexpr std::size_t POOL_SLAB_SIZE = 64 * 1024;
+        static constexpr std::size_t MAX_POOLS = 16;
+
+        /// Pools are never destroyed, objects may still be freed by static destructors at shutdown
+        static ObjectPool& Create(char const* name, std::size_t blockSize);
+        static void ForEach(std::function<void(ObjectPool const&)> const& visitor);
+
+        void* Allocate(std::size_t size);
+        void Deallocate(void* ptr, std::size_t size);
+
+        [[nodiscard]] char const* GetName() const { return _name; }
+        [[nodiscard]] std::size_t GetBlockSize() const { return _blockSize; }
+        [[nodiscard]] uint64 GetBlocksInUse() const { return _blocksInUse.load(std::memory_order_relaxed); }
+        [[nodiscard]] uint64 GetBlockCapacity() const { return _blockCapacity.load(std::memory_order_relaxed); }
+
+    private:
+        ObjectPool(std::size_t index, char const* name, std::size_t blockSize);
+
+        friend struct ObjectPoolThreadGuard;
+
+        void Refill(ObjectPoolFreeList& cache, std::size_t count);
+        void Flush(ObjectPoolFreeList& cache, std::size_t count);
+
+        std::size_t const _index;
+        char const* const _name;
+        std::size_t const _blockSize;
+        std::size_t const _blocksPerSlab;
+        std::size_t const _batchSize;
+
+        std::mutex _lock;
+        ObjectPoolFreeList _freeBlocks;
+        std::atomic<uint64> _blocksInUse;
+        std::atomic<uint64> _blockCapacity;
+    };
+}
+
+#endif // _OBJECT_POOL_H
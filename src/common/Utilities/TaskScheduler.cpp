@@ -17,6 +17,8 @@
 
 #include "TaskScheduler.h"
 #include "Errors.h"
+#include <algorithm>
+#include <utility>
 
 TaskScheduler& TaskScheduler::ClearValidator()
 {
@@ -52,9 +54,9 @@ TaskScheduler& TaskScheduler::CancelAll()
 
 TaskScheduler& TaskScheduler::CancelGroup(group_t const group)
 {
-    _task_holder.RemoveIf([group](TaskContainer const & task) -> bool
+    _task_holder.RemoveIf([group](Task const& task) -> bool
     {
-        return task->IsInGroup(group);
+        return task.IsInGroup(group);
     });
     return *this;
 }
@@ -67,9 +69,18 @@ TaskScheduler& TaskScheduler::CancelGroupsOf(std::vector<group_t> const& groups)
     return *this;
 }
 
-TaskScheduler& TaskScheduler::InsertTask(TaskContainer task)
+TaskScheduler& TaskScheduler::InsertTask(timepoint_t const& end, duration_t const& duration, std::optional<group_t> const& group, TaskHandler&& task)
 {
-    _task_holder.Push(std::move(task));
+    static repeated_t const DEFAULT_REPEATED = 0;
+    _task_holder.Push(Task(end, duration, group, DEFAULT_REPEATED, _task_holder.NextSequence(), std::move(task)));
+    return *this;
+}
+
+TaskScheduler& TaskScheduler::RepeatTask(Task& task)
+{
+    // ordered like a task inserted right now
+    task._sequence = _task_holder.NextSequence();
+    task._requeue = true;
     return *this;
 }
 
@@ -96,18 +107,31 @@ void TaskScheduler::Dispatch(success_t const& callback)
 
     while (!_task_holder.IsEmpty())
     {
-        if (_task_holder.First()->_end > _now)
+        if (_task_holder.First()._end > _now)
         {
             break;
         }
 
+        // The task is owned by this frame while it is invoked,
+        // the callable may destroy this scheduler.
+        Task task = _task_holder.Pop();
+        Task* const executing = _task_holder.SetExecuting(&task);
+
         // Perfect forward the context to the handler
         // Use weak references to catch destruction before callbacks.
-        TaskContext context(_task_holder.Pop(), std::weak_ptr<TaskScheduler>(self_reference));
+        TaskContext context(task, std::weak_ptr<TaskScheduler>(self_reference));
 
         // Invoke the context
         context.Invoke();
 
+        _task_holder.SetExecuting(executing);
+        if (task._requeue)
+        {
+            task._consumed = false;
+            task._requeue = false;
+            _task_holder.Push(std::move(task));
+        }
+
         // If the validation failed abort the dispatching here.
         if (!_predicate())
         {
@@ -124,69 +148,95 @@ bool TaskScheduler::IsGroupScheduled(group_t const group)
     return _task_holder.IsGroupQueued(group);
 }
 
-void TaskScheduler::TaskQueue::Push(TaskContainer&& task)
+void TaskScheduler::TaskQueue::Push(Task&& task)
 {
-    container.insert(task);
+    container.push_back(std::move(task));
+    std::push_heap(container.begin(), container.end(), std::greater<Task>());
 }
 
-auto TaskScheduler::TaskQueue::Pop() -> TaskContainer
+auto TaskScheduler::TaskQueue::Pop() -> Task
 {
-    TaskContainer result = *container.begin();
-    container.erase(container.begin());
+    std::pop_heap(container.begin(), container.end(), std::greater<Task>());
+    Task result = std::move(container.back());
+    container.pop_back();
     return result;
 }
 
-auto TaskScheduler::TaskQueue::First() const -> TaskContainer const&
+auto TaskScheduler::TaskQueue::First() const -> Task const&
 {
-    return *container.begin();
+    return container.front();
+}
+
+auto TaskScheduler::TaskQueue::SetExecuting(Task* task) -> Task*
+{
+    return std::exchange(executing, task);
+}
+
+uint64 TaskScheduler::TaskQueue::NextSequence()
+{
+    return ++sequence;
 }
 
 void TaskScheduler::TaskQueue::Clear()
 {
     container.clear();
+
+    if (executing)
+    {
+        executing->_requeue = false;
+    }
 }
 
-void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(TaskContainer const&)> const& filter)
+void TaskScheduler::TaskQueue::RemoveIf(std::function<bool(Task const&)> const& filter)
 {
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            itr = container.erase(itr);
-        }
-        else
-        {
-            ++itr;
-        }
+    container.erase(std::remove_if(container.begin(), container.end(), filter), container.end());
+    std::make_heap(container.begin(), container.end(), std::greater<Task>());
+
+    if (executing && executing->_requeue && filter(*executing))
+    {
+        executing->_requeue = false;
+    }
 }
 
-void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(TaskContainer const&)> const& filter)
+void TaskScheduler::TaskQueue::ModifyIf(std::function<bool(Task&)> const& filter)
 {
-    std::vector<TaskContainer> cache;
-    for (auto itr = container.begin(); itr != container.end();)
-        if (filter(*itr))
-        {
-            cache.push_back(*itr);
-            itr = container.erase(itr);
-        }
-        else
+    std::vector<Task*> tasks;
+    tasks.reserve(container.size() + 1);
+    for (Task& task : container)
+        tasks.push_back(&task);
+
+    if (executing && executing->_requeue)
+    {
+        tasks.push_back(executing);
+    }
+
+    // Modified tasks are ordered behind unmodified tasks with the same end,
+    // among each other they keep their previous order.
+    std::sort(tasks.begin(), tasks.end(), [](Task const* left, Task const* right)
+    {
+        return *left < *right;
+    });
+
+    for (Task* task : tasks)
+        if (filter(*task))
         {
-            ++itr;
+            task->_sequence = NextSequence();
         }
 
-    container.insert(cache.begin(), cache.end());
+    std::make_heap(container.begin(), container.end(), std::greater<Task>());
 }
 
 bool TaskScheduler::TaskQueue::IsGroupQueued(group_t const group)
 {
     for (auto const& task : container)
     {
-        if (task->IsInGroup(group))
+        if (task.IsInGroup(group))
         {
             return true;
         }
     }
 
-    return false;
+    return executing && executing->_requeue && executing->IsInGroup(group);
 }
 
 bool TaskScheduler::TaskQueue::IsEmpty() const
@@ -194,14 +244,9 @@ bool TaskScheduler::TaskQueue::IsEmpty() const
     return container.empty();
 }
 
-TaskContext& TaskContext::Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply)
+void TaskScheduler::TaskHandler::operator() (TaskContext context)
 {
-    if (auto const owner = _owner.lock())
-    {
-        apply(*owner);
-    }
-
-    return *this;
+    _operations->Invoke(&_storage, std::move(context));
 }
 
 bool TaskContext::IsExpired() const
@@ -255,7 +300,7 @@ void TaskContext::AssertOnConsumed() const
 {
     // This was adapted to TC to prevent static analysis tools from complaining.
     // If you encounter this assertion check if you repeat a TaskContext more then 1 time!
-    ASSERT(!(*_consumed) && "Bad task logic, task context was consumed already!");
+    ASSERT(_task && !_task->_consumed && "Bad task logic, task context was consumed already!");
 }
 
 void TaskContext::Invoke()
@@ -20,10 +20,13 @@
 
 #include "Util.h"
 #include <chrono>
+#include <cstddef>
 #include <functional>
+#include <memory>
+#include <new>
 #include <optional>
 #include <queue>
-#include <set>
+#include <type_traits>
 #include <vector>
 
 class TaskContext;
@@ -41,6 +44,8 @@ class TaskContext;
 /// with the same duration or a new one.
 /// It also provides access to the repeat counter which is useful for task that repeat itself often
 /// but behave different every time (spoken event dialogs for example).
+/// Tasks and their callables are stored by value in a binary heap, scheduling a task
+/// with a small callable (the usual lambda capturing this and a few values) does not allocate.
 class TaskScheduler
 {
     friend class TaskContext;
@@ -54,13 +59,112 @@ class TaskScheduler
     typedef uint32 group_t;
     // Task repeated type
     typedef uint32 repeated_t;
-    // Task handle type
-    typedef std::function<void(TaskContext)> task_handler_t;
     // Predicate type
     typedef std::function<bool()> predicate_t;
     // Success handle type
     typedef std::function<void()> success_t;
 
+    /// Type erased void(TaskContext) callable, callables up to INLINE_SIZE bytes
+    /// are stored inside of the handler, bigger ones on the heap.
+    class TaskHandler
+    {
+    public:
+        static constexpr std::size_t INLINE_SIZE = 48;
+
+        template<typename Callable, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Callable>, TaskHandler>>>
+        TaskHandler(Callable&& callable)
+        {
+            typedef std::decay_t<Callable> Stored;
+            constexpr bool isInline = sizeof(Stored) <= INLINE_SIZE && alignof(Stored) <= alignof(std::max_align_t)
+                && std::is_nothrow_move_constructible_v<Stored>;
+
+            if constexpr (isInline)
+                new (&_storage) Stored(std::forward<Callable>(callable));
+            else
+                *reinterpret_cast<Stored**>(&_storage) = new Stored(std::forward<Callable>(callable));
+
+            _operations = &Operations<Stored, isInline>::Table;
+        }
+
+        TaskHandler(TaskHandler&& right) noexcept
+            : _operations(right._operations)
+        {
+            if (_operations)
+                _operations->Move(&_storage, &right._storage);
+
+            right._operations = nullptr;
+        }
+
+        TaskHandler& operator= (TaskHandler&& right) noexcept
+        {
+            if (this != &right)
+            {
+                this->~TaskHandler();
+                new (this) TaskHandler(std::move(right));
+            }
+
+            return *this;
+        }
+
+        TaskHandler(TaskHandler const&) = delete;
+        TaskHandler& operator= (TaskHandler const&) = delete;
+
+        ~TaskHandler()
+        {
+            if (_operations)
+                _operations->Destroy(&_storage);
+        }
+
+        void operator() (TaskContext context);
+
+    private:
+        struct OperationTable
+        {
+            void(*Invoke)(void* storage, TaskContext context);
+            // Move constructs the callable into to and destroys the one in from
+            void(*Move)(void* to, void* from);
+            void(*Destroy)(void* storage);
+        };
+
+        template<typename Stored, bool IsInline>
+        struct Operations
+        {
+            static Stored& Get(void* storage)
+            {
+                if constexpr (IsInline)
+                    return *std::launder(static_cast<Stored*>(storage));
+                else
+                    return **static_cast<Stored**>(storage);
+            }
+
+            static void Invoke(void* storage, TaskContext context);
+
+            static void Move(void* to, void* from)
+            {
+                if constexpr (IsInline)
+                {
+                    new (to) Stored(std::move(Get(from)));
+                    Get(from).~Stored();
+                }
+                else
+                    *static_cast<Stored**>(to) = *static_cast<Stored**>(from);
+            }
+
+            static void Destroy(void* storage)
+            {
+                if constexpr (IsInline)
+                    Get(storage).~Stored();
+                else
+                    delete &Get(storage);
+            }
+
+            static constexpr OperationTable Table = { &Invoke, &Move, &Destroy };
+        };
+
+        alignas(std::max_align_t) std::byte _storage[INLINE_SIZE];
+        OperationTable const* _operations;
+    };
+
     class Task
     {
         friend class TaskContext;
@@ -70,42 +174,39 @@ class TaskScheduler
         duration_t _duration;
         std::optional<group_t> _group;
         repeated_t _repeated;
-        task_handler_t _task;
+        // Tasks with the same end are executed in the order they were queued
+        uint64 _sequence;
+        // The task context of the current invocation was consumed
+        bool _consumed;
+        // The task is queued again once its current invocation returns
+        bool _requeue;
+        TaskHandler _task;
 
     public:
         // All Argument construct
         Task(timepoint_t const& end, duration_t const& duration, std::optional<group_t> const& group,
-             repeated_t const repeated, task_handler_t const& task)
-            : _end(end), _duration(duration), _group(group), _repeated(repeated), _task(task) { }
-
-        // Minimal Argument construct
-        Task(timepoint_t const& end, duration_t const& duration, task_handler_t const& task)
-            : _end(end), _duration(duration), _group(std::nullopt), _repeated(0), _task(task) { }
+             repeated_t const repeated, uint64 const sequence, TaskHandler&& task)
+            : _end(end), _duration(duration), _group(group), _repeated(repeated), _sequence(sequence),
+              _consumed(false), _requeue(false), _task(std::move(task)) { }
 
         // Copy construct
         Task(Task const&) = delete;
         // Move construct
-        Task(Task&&) = delete;
+        Task(Task&&) = default;
         // Copy Assign
-        Task& operator= (Task const&) = default;
+        Task& operator= (Task const&) = delete;
         // Move Assign
-        Task& operator= (Task&& right) = delete;
+        Task& operator= (Task&& right) = default;
 
         // Order tasks by its end
         inline bool operator< (Task const& other) const
         {
-            return _end < other._end;
+            return _end < other._end || (_end == other._end && _sequence < other._sequence);
         }
 
         inline bool operator> (Task const& other) const
         {
-            return _end > other._end;
-        }
-
-        // Compare tasks with its end
-        inline bool operator== (Task const& other)
-        {
-            return _end == other._end;
+            return other < *this;
         }
 
         // Returns true if the task is in the given group
@@ -115,35 +216,38 @@ class TaskScheduler
         }
     };
 
-    typedef std::shared_ptr<Task> TaskContainer;
-
     /// Container which provides Task order, insert and reschedule operations.
-    struct Compare
-    {
-        bool operator() (TaskContainer const& left, TaskContainer const& right) const
-        {
-            return (*left.get()) < (*right.get());
-        };
-    };
-
     class TaskQueue
     {
-        std::multiset<TaskContainer, Compare> container;
+        /// Binary min heap of the queued tasks
+        std::vector<Task> container;
+
+        /// The task executed right now, it is part of the queue again
+        /// (cancel, delay and reschedule apply to it) once it repeated itself.
+        Task* executing = nullptr;
+
+        uint64 sequence = 0;
 
     public:
         // Pushes the task in the container
-        void Push(TaskContainer&& task);
+        void Push(Task&& task);
 
         /// Pops the task out of the container
-        TaskContainer Pop();
+        Task Pop();
+
+        Task const& First() const;
+
+        /// Sets the task executed right now and returns the previous one
+        Task* SetExecuting(Task* task);
 
-        TaskContainer const& First() const;
+        /// Returns the next insertion sequence number
+        uint64 NextSequence();
 
         void Clear();
 
-        void RemoveIf(std::function<bool(TaskContainer const&)> const& filter);
+        void RemoveIf(std::function<bool(Task const&)> const& filter);
 
-        void ModifyIf(std::function<bool(TaskContainer const&)> const& filter);
+        void ModifyIf(std::function<bool(Task&)> const& filter);
 
         /// Check if the group exists and is currently scheduled.
         bool IsGroupQueued(group_t const group);
@@ -225,39 +329,39 @@ public:
 
     /// Schedule an event with a fixed rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
-    template<class _Rep, class _Period>
+    template<class _Rep, class _Period, class _Callable>
     TaskScheduler& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                            task_handler_t const& task)
+                            _Callable&& task)
     {
-        return ScheduleAt(_now, time, task);
+        return ScheduleAt(_now, time, std::forward<_Callable>(task));
     }
 
     /// Schedule an event with a fixed rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
-    template<class _Rep, class _Period>
+    template<class _Rep, class _Period, class _Callable>
     TaskScheduler& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                            group_t const group, task_handler_t const& task)
+                            group_t const group, _Callable&& task)
     {
-        return ScheduleAt(_now, time, group, task);
+        return ScheduleAt(_now, time, group, std::forward<_Callable>(task));
     }
 
     /// Schedule an event with a randomized rate between min and max rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
-    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
+    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight, class _Callable>
     TaskScheduler& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
-                            std::chrono::duration<_RepRight, _PeriodRight> const& max, task_handler_t const& task)
+                            std::chrono::duration<_RepRight, _PeriodRight> const& max, _Callable&& task)
     {
-        return Schedule(RandomDurationBetween(min, max), task);
+        return Schedule(RandomDurationBetween(min, max), std::forward<_Callable>(task));
     }
 
     /// Schedule an event with a fixed rate.
     /// Never call this from within a task context! Use TaskContext::Schedule instead!
-    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
+    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight, class _Callable>
     TaskScheduler& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
                             std::chrono::duration<_RepRight, _PeriodRight> const& max, group_t const group,
-                            task_handler_t const& task)
+                            _Callable&& task)
     {
-        return Schedule(RandomDurationBetween(min, max), group, task);
+        return Schedule(RandomDurationBetween(min, max), group, std::forward<_Callable>(task));
     }
 
     /// Cancels all tasks.
@@ -279,9 +383,9 @@ public:
     template<class _Rep, class _Period>
     TaskScheduler& DelayAll(std::chrono::duration<_Rep, _Period> const& duration)
     {
-        _task_holder.ModifyIf([&duration](TaskContainer const & task) -> bool
+        _task_holder.ModifyIf([&duration](Task& task) -> bool
         {
-            task->_end += duration;
+            task._end += duration;
             return true;
         });
         return *this;
@@ -299,11 +403,11 @@ public:
     template<class _Rep, class _Period>
     TaskScheduler& DelayGroup(group_t const group, std::chrono::duration<_Rep, _Period> const& duration)
     {
-        _task_holder.ModifyIf([&duration, group](TaskContainer const & task) -> bool
+        _task_holder.ModifyIf([&duration, group](Task& task) -> bool
         {
-            if (task->IsInGroup(group))
+            if (task.IsInGroup(group))
             {
-                task->_end += duration;
+                task._end += duration;
                 return true;
             }
             else
@@ -328,9 +432,9 @@ public:
     TaskScheduler& RescheduleAll(std::chrono::duration<_Rep, _Period> const& duration)
     {
         auto const end = _now + duration;
-        _task_holder.ModifyIf([end](TaskContainer const & task) -> bool
+        _task_holder.ModifyIf([end](Task& task) -> bool
         {
-            task->_end = end;
+            task._end = end;
             return true;
         });
         return *this;
@@ -349,11 +453,11 @@ public:
     TaskScheduler& RescheduleGroup(group_t const group, std::chrono::duration<_Rep, _Period> const& duration)
     {
         auto const end = _now + duration;
-        _task_holder.ModifyIf([end, group](TaskContainer const & task) -> bool
+        _task_holder.ModifyIf([end, group](Task& task) -> bool
         {
-            if (task->IsInGroup(group))
+            if (task.IsInGroup(group))
             {
-                task->_end = end;
+                task._end = end;
                 return true;
             }
             else
@@ -375,24 +479,26 @@ public:
 
 private:
     /// Insert a new task to the enqueued tasks.
-    TaskScheduler& InsertTask(TaskContainer task);
+    TaskScheduler& InsertTask(timepoint_t const& end, duration_t const& duration, std::optional<group_t> const& group, TaskHandler&& task);
 
-    template<class _Rep, class _Period>
+    /// Queues the executing task again once its invocation returns.
+    TaskScheduler& RepeatTask(Task& task);
+
+    template<class _Rep, class _Period, class _Callable>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
-                              std::chrono::duration<_Rep, _Period> const& time, task_handler_t const& task)
+                              std::chrono::duration<_Rep, _Period> const& time, _Callable&& task)
     {
-        return InsertTask(TaskContainer(new Task(end + time, time, task)));
+        return InsertTask(end + time, time, std::nullopt, TaskHandler(std::forward<_Callable>(task)));
     }
 
     /// Schedule an event with a fixed rate.
     /// Never call this from within a task context! Use TaskContext::schedule instead!
-    template<class _Rep, class _Period>
+    template<class _Rep, class _Period, class _Callable>
     TaskScheduler& ScheduleAt(timepoint_t const& end,
                               std::chrono::duration<_Rep, _Period> const& time,
-                              group_t const group, task_handler_t const& task)
+                              group_t const group, _Callable&& task)
     {
-        static repeated_t const DEFAULT_REPEATED = 0;
-        return InsertTask(TaskContainer(new Task(end + time, time, group, DEFAULT_REPEATED, task)));
+        return InsertTask(end + time, time, group, TaskHandler(std::forward<_Callable>(task)));
     }
 
     // Returns a random duration between min and max
@@ -415,52 +521,45 @@ class TaskContext
 {
     friend class TaskScheduler;
 
-    /// Associated task
-    TaskScheduler::TaskContainer _task;
+    /// Associated task, owned by TaskScheduler::Dispatch while it is invoked.
+    /// A context is only valid during the invocation of its task.
+    TaskScheduler::Task* _task;
 
     /// Owner
     std::weak_ptr<TaskScheduler> _owner;
 
-    /// Marks the task as consumed
-    std::shared_ptr<bool> _consumed;
-
     /// Dispatches an action safe on the TaskScheduler
-    TaskContext& Dispatch(std::function<TaskScheduler&(TaskScheduler&)> const& apply);
+    template<typename _Apply>
+    TaskContext& Dispatch(_Apply&& apply)
+    {
+        if (auto const owner = _owner.lock())
+        {
+            apply(*owner);
+        }
+
+        return *this;
+    }
 
 public:
     // Empty constructor
     TaskContext()
-        : _task(), _owner(), _consumed(std::make_shared<bool>(true)) { }
+        : _task(nullptr), _owner() { }
 
     // Construct from task and owner
-    explicit TaskContext(TaskScheduler::TaskContainer&& task, std::weak_ptr<TaskScheduler>&& owner)
-        : _task(task), _owner(owner), _consumed(std::make_shared<bool>(false)) { }
+    explicit TaskContext(TaskScheduler::Task& task, std::weak_ptr<TaskScheduler>&& owner)
+        : _task(&task), _owner(std::move(owner)) { }
 
     // Copy construct
-    TaskContext(TaskContext const& right)
-        : _task(right._task), _owner(right._owner), _consumed(right._consumed) { }
+    TaskContext(TaskContext const& right) = default;
 
     // Move construct
-    TaskContext(TaskContext&& right) noexcept
-        : _task(std::move(right._task)), _owner(std::move(right._owner)), _consumed(std::move(right._consumed)) { }
+    TaskContext(TaskContext&& right) noexcept = default;
 
     // Copy assign
-    TaskContext& operator= (TaskContext const& right) noexcept
-    {
-        _task = right._task;
-        _owner = right._owner;
-        _consumed = right._consumed;
-        return *this;
-    }
+    TaskContext& operator= (TaskContext const& right) = default;
 
     // Move assign
-    TaskContext& operator= (TaskContext&& right) noexcept
-    {
-        _task = std::move(right._task);
-        _owner = std::move(right._owner);
-        _consumed = std::move(right._consumed);
-        return *this;
-    }
+    TaskContext& operator= (TaskContext&& right) noexcept = default;
 
     /// Returns true if the owner was deallocated and this context has expired.
     bool IsExpired() const;
@@ -490,8 +589,11 @@ public:
         _task->_duration = duration;
         _task->_end += duration;
         _task->_repeated += 1;
-        (*_consumed) = true;
-        return Dispatch(std::bind(&TaskScheduler::InsertTask, std::placeholders::_1, _task));
+        _task->_consumed = true;
+        return Dispatch([this](TaskScheduler& scheduler) -> TaskScheduler&
+        {
+            return scheduler.RepeatTask(*_task);
+        });
     }
 
     /// Repeats the event with the same duration.
@@ -521,14 +623,14 @@ public:
     /// Its possible that the new event is executed immediately!
     /// Use TaskScheduler::Async to create a task
     /// which will be called at the next update tick.
-    template<class _Rep, class _Period>
+    template<class _Rep, class _Period, class _Callable>
     TaskContext& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                          TaskScheduler::task_handler_t const& task)
+                          _Callable&& task)
     {
         auto const end = _task->_end;
-        return Dispatch([end, time, task](TaskScheduler & scheduler) -> TaskScheduler &
+        return Dispatch([&](TaskScheduler & scheduler) -> TaskScheduler &
         {
-            return scheduler.ScheduleAt<_Rep, _Period>(end, time, task);
+            return scheduler.ScheduleAt(end, time, std::forward<_Callable>(task));
         });
     }
 
@@ -536,14 +638,14 @@ public:
     /// Its possible that the new event is executed immediately!
     /// Use TaskScheduler::Async to create a task
     /// which will be called at the next update tick.
-    template<class _Rep, class _Period>
+    template<class _Rep, class _Period, class _Callable>
     TaskContext& Schedule(std::chrono::duration<_Rep, _Period> const& time,
-                          TaskScheduler::group_t const group, TaskScheduler::task_handler_t const& task)
+                          TaskScheduler::group_t const group, _Callable&& task)
     {
         auto const end = _task->_end;
-        return Dispatch([end, time, group, task](TaskScheduler & scheduler) -> TaskScheduler &
+        return Dispatch([&](TaskScheduler & scheduler) -> TaskScheduler &
         {
-            return scheduler.ScheduleAt<_Rep, _Period>(end, time, group, task);
+            return scheduler.ScheduleAt(end, time, group, std::forward<_Callable>(task));
         });
     }
 
@@ -551,23 +653,23 @@ public:
     /// Its possible that the new event is executed immediately!
     /// Use TaskScheduler::Async to create a task
     /// which will be called at the next update tick.
-    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
+    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight, class _Callable>
     TaskContext& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
-                          std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::task_handler_t const& task)
+                          std::chrono::duration<_RepRight, _PeriodRight> const& max, _Callable&& task)
     {
-        return Schedule(TaskScheduler::RandomDurationBetween(min, max), task);
+        return Schedule(TaskScheduler::RandomDurationBetween(min, max), std::forward<_Callable>(task));
     }
 
     /// Schedule an event with a randomized rate between min and max rate from within the context.
     /// Its possible that the new event is executed immediately!
     /// Use TaskScheduler::Async to create a task
     /// which will be called at the next update tick.
-    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight>
+    template<class _RepLeft, class _PeriodLeft, class _RepRight, class _PeriodRight, class _Callable>
     TaskContext& Schedule(std::chrono::duration<_RepLeft, _PeriodLeft> const& min,
                           std::chrono::duration<_RepRight, _PeriodRight> const& max, TaskScheduler::group_t const group,
-                          TaskScheduler::task_handler_t const& task)
+                          _Callable&& task)
     {
-        return Schedule(TaskScheduler::RandomDurationBetween(min, max), group, task);
+        return Schedule(TaskScheduler::RandomDurationBetween(min, max), group, std::forward<_Callable>(task));
     }
 
     /// Cancels all tasks from within the context.
@@ -615,7 +717,7 @@ public:
     template<class _Rep, class _Period>
     TaskContext& RescheduleAll(std::chrono::duration<_Rep, _Period> const& duration)
     {
-        return Dispatch(std::bind(&TaskScheduler::RescheduleAll, std::placeholders::_1, duration));
+        return Dispatch(std::bind(&TaskScheduler::RescheduleAll<_Rep, _Period>, std::placeholders::_1, duration));
     }
 
     /// Reschedule all tasks with a random duration between min and max.
@@ -650,4 +752,10 @@ private:
     void Invoke();
 };
 
+template<typename Stored, bool IsInline>
+void TaskScheduler::TaskHandler::Operations<Stored, IsInline>::Invoke(void* storage, TaskContext context)
+{
+    Get(storage)(std::move(context));
+}
+
 #endif
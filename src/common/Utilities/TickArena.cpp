@@ -0,0 +1,97 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TickArena.h"
+#include <array>
+#include <cstddef>
+#include <memory>
+
+namespace
+{
+    // large enough for a usual map update, bigger ticks get additional chunks from the heap until the scope ends
+    constexpr std::size_t TICK_ARENA_INITIAL_SIZE = 64 * 1024;
+
+    class TickArena final : public std::pmr::memory_resource
+    {
+    public:
+        TickArena() : _buffer(_initial.data(), _initial.size(), std::pmr::new_delete_resource()) { }
+
+        void Release()
+        {
+            _buffer.release();
+            Allocations = 0;
+            AllocatedBytes = 0;
+        }
+
+        uint32 Depth = 0;
+        uint64 Allocations = 0;
+        uint64 AllocatedBytes = 0;
+
+    private:
+        void* do_allocate(std::size_t bytes, std::size_t alignment) override
+        {
+            ++Allocations;
+            AllocatedBytes += bytes;
+            return _buffer.allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* /*p*/, std::size_t /*bytes*/, std::size_t /*alignment*/) override { }
+
+        bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+        {
+            return this == &other;
+        }
+
+        alignas(std::max_align_t) std::array<std::byte, TICK_ARENA_INITIAL_SIZE> _initial;
+        std::pmr::monotonic_buffer_resource _buffer;
+    };
+
+    TickArena& GetThreadArena()
+    {
+        // allocated on first use, keeps the initial buffer out of the static TLS block of every thread
+        thread_local std::unique_ptr<TickArena> arena = std::make_unique<TickArena>();
+        return *arena;
+    }
+}
+
+std::pmr::memory_resource* Acore::GetTickArenaResource()
+{
+    TickArena& arena = GetThreadArena();
+    return arena.Depth ? static_cast<std::pmr::memory_resource*>(&arena) : std::pmr::get_default_resource();
+}
+
+Acore::TickArenaScope::TickArenaScope()
+{
+    ++GetThreadArena().Depth;
+}
+
+Acore::TickArenaScope::~TickArenaScope()
+{
+    TickArena& arena = GetThreadArena();
+    if (--arena.Depth == 0)
+        arena.Release();
+}
+
+uint64 Acore::TickArenaScope::GetAllocations() const
+{
+    return GetThreadArena().Allocations;
+}
+
+uint64 Acore::TickArenaScope::GetAllocatedBytes() const
+{
+    return GetThreadArena().AllocatedBytes;
+}
@@ -0,0 +1,54 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _TICK_ARENA_H
+#define _TICK_ARENA_H
+
+#include "Define.h"
+#include <memory_resource>
+
+/**
+ * @brief Per thread monotonic arena for containers that only live during a single update tick.
+ *
+ * While a TickArenaScope is alive on a thread, GetTickArenaResource() returns that thread's arena:
+ * allocations are bump allocated from a reused buffer, deallocations are no-ops and all memory is
+ * released at once when the outermost scope ends. Without an active scope the default resource
+ * (operator new) is returned, so code using the arena may also run outside of scoped updates.
+ *
+ * Containers using the arena must not outlive the scope they were created in.
+ */
+
+namespace Acore
+{
+    AC_COMMON_API std::pmr::memory_resource* GetTickArenaResource();
+
+    class AC_COMMON_API TickArenaScope
+    {
+    public:
+        TickArenaScope();
+        ~TickArenaScope();
+
+        TickArenaScope(TickArenaScope const&) = delete;
+        TickArenaScope& operator=(TickArenaScope const&) = delete;
+
+        /// Allocations and bytes served by the arena of this thread since the outermost scope started
+        [[nodiscard]] uint64 GetAllocations() const;
+        [[nodiscard]] uint64 GetAllocatedBytes() const;
+    };
+}
+
+#endif // _TICK_ARENA_H
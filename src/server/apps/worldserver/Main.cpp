@@ -26,6 +26,7 @@
 #include "Banner.h"
 #include "BattlegroundMgr.h"
 #include "BigNumber.h"
+#include "CharacterCache.h"
 #include "CliRunnable.h"
 #include "Common.h"
 #include "Config.h"
@@ -579,6 +580,7 @@ void WorldUpdateLoop()
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
+    sCharacterCache->WarnAboutSyncLoads(true);
 
     ///- While we have not World::m_stopEvent, update the world
     while (!World::IsStopped())
@@ -612,6 +614,7 @@ void WorldUpdateLoop()
     LoginDatabase.WarnAboutSyncQueries(false);
     CharacterDatabase.WarnAboutSyncQueries(false);
     WorldDatabase.WarnAboutSyncQueries(false);
+    sCharacterCache->WarnAboutSyncLoads(false);
 }
 
 void SignalHandler(boost::system::error_code const& error, int /*signalNumber*/)
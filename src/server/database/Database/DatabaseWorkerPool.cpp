@@ -31,6 +31,7 @@
 #include "SQLOperation.h"
 #include "Transaction.h"
 #include "WorldDatabase.h"
+#include <algorithm>
 #include <limits>
 #include <mysqld_error.h>
 #include <sstream>
@@ -235,12 +236,16 @@ QueryCallback DatabaseWorkerPool<T>::AsyncQuery(PreparedStatement<T>* stmt)
 }
 
 template <class T>
-SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder)
+SQLQueryHolderCallback DatabaseWorkerPool<T>::DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, std::size_t parts)
 {
-    SQLQueryHolderTask* task = new SQLQueryHolderTask(holder);
+    parts = std::max<std::size_t>(std::min<std::size_t>({ parts, _async_threads, holder->GetSize() }), 1);
+
+    auto state = std::make_shared<SQLQueryHolderTaskState>(parts);
     // Store future result before enqueueing - task might get already processed and deleted before returning from this method
-    QueryResultHolderFuture result = task->GetFuture();
-    Enqueue(task);
+    QueryResultHolderFuture result = state->Result.get_future();
+    for (std::size_t part = 0; part < parts; ++part)
+        Enqueue(new SQLQueryHolderTask(holder, state, part, parts));
+
     return { std::move(holder), std::move(result) };
 }
 
@@ -174,7 +174,9 @@ public:
     //! return object as soon as the query is executed.
     //! The return value is then processed in ProcessQueryCallback methods.
     //! Any prepared statements added to this holder need to be prepared with the CONNECTION_ASYNC flag.
-    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder);
+    //! With parts > 1 the queries are split into that many operations (at most one per async connection)
+    //! that run concurrently, the callback is invoked once all of them completed.
+    SQLQueryHolderCallback DelayQueryHolder(std::shared_ptr<SQLQueryHolder<T>> holder, std::size_t parts = 1);
 
     /**
         Transaction context methods.
@@ -35,6 +35,8 @@ enum CharacterDatabaseStatements : uint32
     CHAR_SEL_DATA_BY_NAME,
     CHAR_SEL_DATA_BY_GUID,
     CHAR_SEL_CHECK_NAME,
+    CHAR_SEL_CHARACTER_CACHE_BY_GUID,
+    CHAR_SEL_CHARACTER_CACHE_BY_NAME,
     CHAR_SEL_CHECK_GUID,
     CHAR_SEL_SUM_CHARS,
     CHAR_SEL_CHAR_CREATE_INFO,
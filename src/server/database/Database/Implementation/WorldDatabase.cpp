@@ -17,6 +17,7 @@
 
 #include "WorldDatabase.h"
 #include "MySQLPreparedStatement.h"
+#include "WorldDatabaseSnapshot.h"
 
 void WorldDatabaseConnection::DoPrepareStatements()
 {
@@ -108,3 +109,8 @@ WorldDatabaseConnection::WorldDatabaseConnection(ProducerConsumerQueue<SQLOperat
 WorldDatabaseConnection::~WorldDatabaseConnection()
 {
 }
+
+void WorldDatabaseConnection::OnExecuted(std::string_view sql)
+{
+    sWorldDatabaseSnapshot->OnWrite(sql);
+}
@@ -116,6 +116,10 @@ public:
 
     //- Loads database type specific prepared statements
     void DoPrepareStatements() override;
+
+protected:
+    //- Invalidates the world database snapshot when a snapshotted table is written
+    void OnExecuted(std::string_view sql) override;
 };
 
 #endif
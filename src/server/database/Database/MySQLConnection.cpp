@@ -207,6 +207,7 @@ bool MySQLConnection::Execute(std::string_view sql)
             LOG_DEBUG("sql.sql", "[{} ms] SQL: {}", getMSTimeDiff(_s, getMSTime()), sql);
     }
 
+    OnExecuted(sql);
     return true;
 }
 
@@ -258,6 +259,7 @@ bool MySQLConnection::Execute(PreparedStatementBase* stmt)
     LOG_DEBUG("sql.sql", "[{} ms] SQL(p): {}", getMSTimeDiff(_s, getMSTime()), m_mStmt->getQueryString());
 
     m_mStmt->ClearParameters();
+    OnExecuted(m_mStmt->GetSqlText());
     return true;
 }
 
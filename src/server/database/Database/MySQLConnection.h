@@ -100,6 +100,8 @@ protected:
 
     virtual void DoPrepareStatements() = 0;
     virtual bool _HandleMySQLErrno(uint32 errNo, uint8 attempts = 5);
+    /// Called on the executing thread after a statement without result (raw or prepared) succeeded
+    virtual void OnExecuted(std::string_view /*sql*/) { }
 
     typedef std::vector<std::unique_ptr<MySQLPreparedStatement>> PreparedStatementContainer;
 
@@ -58,6 +58,7 @@ protected:
     void ClearParameters();
     void AssertValidIndex(const uint8 index);
     std::string getQueryString() const;
+    std::string const& GetSqlText() const { return m_queryString; } // without the bound parameters
 
 private:
     MySQLStmt* m_Mstmt;
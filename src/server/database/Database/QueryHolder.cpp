@@ -76,12 +76,14 @@ SQLQueryHolderTask::~SQLQueryHolderTask() = default;
 
 bool SQLQueryHolderTask::Execute()
 {
-    /// execute all queries in the holder and pass the results
-    for (std::size_t i = 0; i < m_holder->m_queries.size(); ++i)
+    /// execute the queries of this part and pass the results, parts only write their own result slots
+    for (std::size_t i = m_part; i < m_holder->m_queries.size(); i += m_partCount)
         if (PreparedStatementBase* stmt = m_holder->m_queries[i].first)
             m_holder->SetPreparedResult(i, m_conn->Query(stmt));
 
-    m_result.set_value();
+    if (--m_state->PendingParts == 0)
+        m_state->Result.set_value();
+
     return true;
 }
 
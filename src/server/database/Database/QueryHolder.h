@@ -19,6 +19,8 @@
 #define _QUERYHOLDER_H
 
 #include "SQLOperation.h"
+#include <atomic>
+#include <future>
 #include <vector>
 
 class AC_DATABASE_API SQLQueryHolderBase
@@ -29,6 +31,7 @@ public:
     SQLQueryHolderBase() = default;
     virtual ~SQLQueryHolderBase();
     void SetSize(std::size_t size);
+    [[nodiscard]] std::size_t GetSize() const { return m_queries.size(); }
     PreparedQueryResult GetPreparedResult(std::size_t index) const;
     void SetPreparedResult(std::size_t index, PreparedResultSet* result);
 
@@ -49,20 +52,35 @@ public:
     }
 };
 
+/// Completion state shared by the parts of a holder, the last finished part fulfills the promise
+struct SQLQueryHolderTaskState
+{
+    explicit SQLQueryHolderTaskState(std::size_t parts) : PendingParts(parts) { }
+
+    QueryResultHolderPromise Result;
+    std::atomic<std::size_t> PendingParts;
+};
+
 class AC_DATABASE_API SQLQueryHolderTask : public SQLOperation
 {
 public:
     explicit SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder)
-        : m_holder(std::move(holder)) { }
+        : SQLQueryHolderTask(std::move(holder), std::make_shared<SQLQueryHolderTaskState>(1), 0, 1) { }
+
+    /// Executes every partCount-th query of the holder starting at part, so the parts can run on different async connections
+    SQLQueryHolderTask(std::shared_ptr<SQLQueryHolderBase> holder, std::shared_ptr<SQLQueryHolderTaskState> state, std::size_t part, std::size_t partCount)
+        : m_holder(std::move(holder)), m_state(std::move(state)), m_part(part), m_partCount(partCount) { }
 
     ~SQLQueryHolderTask();
 
     bool Execute() override;
-    QueryResultHolderFuture GetFuture() { return m_result.get_future(); }
+    QueryResultHolderFuture GetFuture() { return m_state->Result.get_future(); }
 
 private:
     std::shared_ptr<SQLQueryHolderBase> m_holder;
-    QueryResultHolderPromise m_result;
+    std::shared_ptr<SQLQueryHolderTaskState> m_state;
+    std::size_t m_part;
+    std::size_t m_partCount;
 };
 
 class AC_DATABASE_API SQLQueryHolderCallback
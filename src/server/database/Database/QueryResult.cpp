@@ -21,6 +21,7 @@
 #include "Log.h"
 #include "MySQLHacks.h"
 #include "MySQLWorkaround.h"
+#include <cstring>
 
 namespace
 {
@@ -168,7 +169,9 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     _rowCount(rowCount),
     _fieldCount(fieldCount),
     _result(result),
-    _fields(fields)
+    _fields(fields),
+    _snapshotRow(nullptr),
+    _snapshotEnd(nullptr)
 {
     _fieldMetadata.resize(_fieldCount);
     _currentRow = new Field[_fieldCount];
@@ -180,6 +183,22 @@ ResultSet::ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, u
     }
 }
 
+ResultSet::ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, char const* rows, char const* rowsEnd, uint64 rowCount, std::shared_ptr<void const> storage) :
+    _fieldMetadata(std::move(fieldMetadata)),
+    _rowCount(rowCount),
+    _fieldCount(uint32(_fieldMetadata.size())),
+    _result(nullptr),
+    _fields(nullptr),
+    _snapshotRow(rows),
+    _snapshotEnd(rowsEnd),
+    _snapshotStorage(std::move(storage))
+{
+    _currentRow = new Field[_fieldCount];
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+        _currentRow[i].SetMetadata(&_fieldMetadata[i]);
+}
+
 ResultSet::~ResultSet()
 {
     CleanUp();
@@ -189,6 +208,9 @@ bool ResultSet::NextRow()
 {
     MYSQL_ROW row;
 
+    if (_snapshotStorage)
+        return NextSnapshotRow();
+
     if (!_result)
         return false;
 
@@ -213,10 +235,47 @@ bool ResultSet::NextRow()
     return true;
 }
 
+bool ResultSet::NextSnapshotRow()
+{
+    // every value is stored as its length (NULL_VALUE_LENGTH for NULL) followed by the
+    // text and a terminating zero, exactly as mysql_fetch_row would have handed it out
+    if (_snapshotRow >= _snapshotEnd)
+    {
+        CleanUp();
+        return false;
+    }
+
+    for (uint32 i = 0; i < _fieldCount; i++)
+    {
+        uint32 length;
+        ASSERT(_snapshotRow + sizeof(length) <= _snapshotEnd, "Truncated query result snapshot row");
+        memcpy(&length, _snapshotRow, sizeof(length));
+        _snapshotRow += sizeof(length);
+
+        if (length == SNAPSHOT_NULL_VALUE_LENGTH)
+        {
+            _currentRow[i].SetStructuredValue(nullptr, 0);
+            continue;
+        }
+
+        ASSERT(_snapshotRow + length + 1 <= _snapshotEnd, "Truncated query result snapshot row");
+        _currentRow[i].SetStructuredValue(_snapshotRow, length);
+        _snapshotRow += length + 1;
+    }
+
+    return true;
+}
+
 std::string ResultSet::GetFieldName(uint32 index) const
 {
     ASSERT(index < _fieldCount);
-    return _fields[index].name;
+    return _fieldMetadata[index].Alias;
+}
+
+QueryResultFieldMetadata const& ResultSet::GetFieldMetadata(uint32 index) const
+{
+    ASSERT(index < _fieldCount);
+    return _fieldMetadata[index];
 }
 
 void ResultSet::CleanUp()
@@ -232,6 +291,10 @@ void ResultSet::CleanUp()
         mysql_free_result(_result);
         _result = nullptr;
     }
+
+    _snapshotRow = nullptr;
+    _snapshotEnd = nullptr;
+    _snapshotStorage.reset();
 }
 
 Field const& ResultSet::operator[](std::size_t index) const
@@ -21,6 +21,7 @@
 #include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "Field.h"
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -48,13 +49,18 @@ private:
 class AC_DATABASE_API ResultSet
 {
 public:
+    static constexpr uint32 SNAPSHOT_NULL_VALUE_LENGTH = 0xFFFFFFFF;
+
     ResultSet(MySQLResult* result, MySQLField* fields, uint64 rowCount, uint32 fieldCount);
+    /// Serves rows that were previously captured by QueryResultSnapshot, storage keeps the row memory alive
+    ResultSet(std::vector<QueryResultFieldMetadata> fieldMetadata, char const* rows, char const* rowsEnd, uint64 rowCount, std::shared_ptr<void const> storage);
     ~ResultSet();
 
     bool NextRow();
     [[nodiscard]] uint64 GetRowCount() const { return _rowCount; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
     [[nodiscard]] std::string GetFieldName(uint32 index) const;
+    [[nodiscard]] QueryResultFieldMetadata const& GetFieldMetadata(uint32 index) const;
 
     [[nodiscard]] Field* Fetch() const { return _currentRow; }
     Field const& operator[](std::size_t index) const;
@@ -87,10 +93,15 @@ protected:
 private:
     void CleanUp();
     void AssertRows(std::size_t sizeRows);
+    bool NextSnapshotRow();
 
     MySQLResult* _result;
     MySQLField* _fields;
 
+    char const* _snapshotRow;
+    char const* _snapshotEnd;
+    std::shared_ptr<void const> _snapshotStorage;
+
     ResultSet(ResultSet const& right) = delete;
     ResultSet& operator=(ResultSet const& right) = delete;
 };
@@ -0,0 +1,502 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldDatabaseSnapshot.h"
+#include "CryptoHash.h"
+#include "DatabaseEnv.h"
+#include "Log.h"
+#include "QueryResult.h"
+#include "Timer.h"
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+namespace
+{
+    constexpr uint32 SNAPSHOT_MAGIC = 0x4E534457; // "WDSN"
+
+    // magic, version, key, checksum, entry count, payload size
+    constexpr std::size_t SNAPSHOT_HEADER_SIZE = 4 + 4 + 20 + 20 + 4 + 8;
+
+    class SnapshotWriter
+    {
+    public:
+        explicit SnapshotWriter(std::vector<char>& buffer) : _buffer(buffer) { }
+
+        template<typename T>
+        void Write(T value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            char const* data = reinterpret_cast<char const*>(&value);
+            _buffer.insert(_buffer.end(), data, data + sizeof(T));
+        }
+
+        void Write(std::string_view value)
+        {
+            Write<uint32>(value.size());
+            _buffer.insert(_buffer.end(), value.begin(), value.end());
+        }
+
+        void Write(char const* data, std::size_t size)
+        {
+            _buffer.insert(_buffer.end(), data, data + size);
+        }
+
+    private:
+        std::vector<char>& _buffer;
+    };
+
+    class SnapshotReader
+    {
+    public:
+        SnapshotReader(char const* data, std::size_t size) : _pos(data), _end(data + size) { }
+
+        template<typename T>
+        bool Read(T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            if (Remaining() < sizeof(T))
+                return false;
+
+            memcpy(&value, _pos, sizeof(T));
+            _pos += sizeof(T);
+            return true;
+        }
+
+        bool Read(std::string& value)
+        {
+            uint32 length;
+            if (!Read(length) || Remaining() < length)
+                return false;
+
+            value.assign(_pos, length);
+            _pos += length;
+            return true;
+        }
+
+        bool Skip(uint64 size, char const*& start)
+        {
+            if (Remaining() < size)
+                return false;
+
+            start = _pos;
+            _pos += size;
+            return true;
+        }
+
+        [[nodiscard]] std::size_t Remaining() const { return std::size_t(_end - _pos); }
+
+    private:
+        char const* _pos;
+        char const* _end;
+    };
+
+    /// Calls visitor with every lower case identifier or keyword of sql, skipping string literals
+    template<typename Visitor>
+    void ForEachSqlIdentifier(std::string_view sql, Visitor&& visitor)
+    {
+        std::string identifier;
+        for (std::size_t i = 0; i < sql.size();)
+        {
+            char const c = sql[i];
+            if (c == '\'' || c == '"')
+            {
+                // skip the literal, including escaped quotes
+                for (++i; i < sql.size() && sql[i] != c; ++i)
+                    if (sql[i] == '\\')
+                        ++i;
+
+                ++i;
+                continue;
+            }
+
+            bool const quoted = c == '`';
+            if (!quoted && !std::isalnum(static_cast<unsigned char>(c)) && c != '_')
+            {
+                ++i;
+                continue;
+            }
+
+            identifier.clear();
+            for (i += quoted ? 1 : 0; i < sql.size(); ++i)
+            {
+                char const ch = sql[i];
+                if (quoted ? ch == '`' : (!std::isalnum(static_cast<unsigned char>(ch)) && ch != '_'))
+                    break;
+
+                identifier += char(std::tolower(static_cast<unsigned char>(ch)));
+            }
+
+            i += quoted ? 1 : 0;
+            if (!visitor(std::string_view(identifier)))
+                return;
+        }
+    }
+}
+
+WorldDatabaseSnapshot* WorldDatabaseSnapshot::instance()
+{
+    static WorldDatabaseSnapshot instance;
+    return &instance;
+}
+
+void WorldDatabaseSnapshot::Initialize(std::string path)
+{
+    _path = std::move(path);
+    _entries.clear();
+    _dirty = false;
+    _served = 0;
+    _captured = 0;
+    _invalidated = false;
+
+    if (!ComputeKey(_key))
+    {
+        LOG_WARN("server.loading", "World database snapshot disabled, the update state of the world database could not be read.");
+        _enabled = false;
+        return;
+    }
+
+    _enabled = true;
+    _tracking = true;
+
+    uint32 oldMSTime = getMSTime();
+    if (Open())
+        LOG_INFO("server.loading", ">> Mapped world database snapshot {} with {} results in {} ms", _path, _entries.size(), GetMSTimeDiffToNow(oldMSTime));
+    else
+        _entries.clear();
+}
+
+void WorldDatabaseSnapshot::Finalize()
+{
+    if (!_enabled)
+        return;
+
+    LOG_INFO("server.loading", ">> Served {} world database queries from the snapshot, {} queried from the database", _served, _captured);
+
+    if (_dirty && !_invalidated)
+    {
+        uint32 oldMSTime = getMSTime();
+        if (Save())
+            LOG_INFO("server.loading", ">> Wrote world database snapshot {} in {} ms", _path, GetMSTimeDiffToNow(oldMSTime));
+    }
+
+    // releases the mapping, the snapshot cannot be deleted while mapped on every platform
+    _entries.clear();
+    _enabled = false;
+
+    // also covers a write that invalidated the snapshot while it was being saved
+    if (_invalidated)
+        RemoveFile();
+}
+
+QueryResult WorldDatabaseSnapshot::Query(std::string_view sql)
+{
+    // a snapshotted table was written during the startup, the remaining loads must see the change
+    if (!_enabled || _invalidated)
+        return WorldDatabase.Query(sql);
+
+    auto itr = _entries.find(std::string(sql));
+    if (itr != _entries.end())
+    {
+        ++_served;
+        return MakeResult(itr->second);
+    }
+
+    // not part of the snapshot (yet), query and keep the rows for the next one
+    // the tables are tracked before the query, a write racing with it invalidates the new snapshot
+    AddTables(sql);
+
+    Entry& entry = _entries[std::string(sql)];
+    entry = Capture(WorldDatabase.Query(sql));
+    _dirty = true;
+    ++_captured;
+    return MakeResult(entry);
+}
+
+void WorldDatabaseSnapshot::OnWrite(std::string_view sql)
+{
+    if (!_tracking || _invalidated)
+        return;
+
+    // statements changing rows start with their verb, anything else (SELECT, SET, ...) does not matter
+    bool isWrite = false;
+    std::string table;
+    {
+        std::lock_guard<std::mutex> guard(_tablesLock);
+        bool first = true;
+        ForEachSqlIdentifier(sql, [&](std::string_view identifier)
+        {
+            if (first)
+            {
+                first = false;
+                isWrite = identifier == "insert" || identifier == "update" || identifier == "delete" || identifier == "replace";
+                return isWrite;
+            }
+
+            // any mention of a snapshotted table counts, invalidating too often is harmless
+            if (_tables.find(std::string(identifier)) == _tables.end())
+                return true;
+
+            table = identifier;
+            return false;
+        });
+    }
+
+    if (!isWrite || table.empty() || _invalidated.exchange(true))
+        return;
+
+    LOG_INFO("sql.sql", "World database snapshot {} invalidated by a write to `{}`.", _path, table);
+
+    // a mapped snapshot is deleted by Finalize()
+    RemoveFile();
+}
+
+void WorldDatabaseSnapshot::AddTables(std::string_view sql)
+{
+    std::lock_guard<std::mutex> guard(_tablesLock);
+    bool tableNext = false;
+    ForEachSqlIdentifier(sql, [&](std::string_view identifier)
+    {
+        if (tableNext)
+            _tables.emplace(identifier);
+
+        tableNext = identifier == "from" || identifier == "join";
+        return true;
+    });
+}
+
+void WorldDatabaseSnapshot::RemoveFile() const
+{
+    std::error_code error;
+    std::filesystem::remove(_path, error);
+}
+
+bool WorldDatabaseSnapshot::ComputeKey(Digest& key)
+{
+    QueryResult result = WorldDatabase.Query("SELECT name, hash, state FROM updates ORDER BY name");
+    if (!result)
+        return false;
+
+    Acore::Crypto::SHA1 hash;
+    do
+    {
+        Field* fields = result->Fetch();
+        for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+        {
+            hash.UpdateData(fields[i].Get<std::string_view>());
+            hash.UpdateData(std::string_view("", 1));
+        }
+    } while (result->NextRow());
+
+    hash.Finalize();
+    key = hash.GetDigest();
+    return true;
+}
+
+bool WorldDatabaseSnapshot::Open()
+{
+    namespace bip = boost::interprocess;
+
+    std::error_code error;
+    if (!std::filesystem::exists(_path, error))
+    {
+        LOG_INFO("server.loading", "No world database snapshot at {}, a new one is written after the world is loaded.", _path);
+        return false;
+    }
+
+    std::shared_ptr<bip::mapped_region> region;
+    try
+    {
+        bip::file_mapping file(_path.c_str(), bip::read_only);
+        region = std::make_shared<bip::mapped_region>(file, bip::read_only);
+    }
+    catch (bip::interprocess_exception const& e)
+    {
+        LOG_WARN("server.loading", "Could not map world database snapshot {}: {}", _path, e.what());
+        return false;
+    }
+
+    char const* data = static_cast<char const*>(region->get_address());
+    SnapshotReader header(data, region->get_size());
+
+    uint32 magic = 0;
+    uint32 version = 0;
+    Digest key{};
+    Digest checksum{};
+    uint32 entryCount = 0;
+    uint64 payloadSize = 0;
+    if (!header.Read(magic) || magic != SNAPSHOT_MAGIC || !header.Read(version) || !header.Read(key) ||
+        !header.Read(checksum) || !header.Read(entryCount) || !header.Read(payloadSize) || header.Remaining() != payloadSize)
+    {
+        LOG_WARN("server.loading", "World database snapshot {} is damaged, loading from the database.", _path);
+        return false;
+    }
+
+    if (version != SNAPSHOT_VERSION || key != _key)
+    {
+        LOG_INFO("server.loading", "World database snapshot {} is outdated, loading from the database.", _path);
+        return false;
+    }
+
+    char const* payload = data + SNAPSHOT_HEADER_SIZE;
+    if (Acore::Crypto::SHA1::GetDigestOf(reinterpret_cast<uint8 const*>(payload), payloadSize) != checksum)
+    {
+        LOG_WARN("server.loading", "World database snapshot {} failed its checksum, loading from the database.", _path);
+        return false;
+    }
+
+    SnapshotReader reader(payload, payloadSize);
+    for (uint32 i = 0; i < entryCount; ++i)
+    {
+        std::string sql;
+        uint32 fieldCount = 0;
+        if (!reader.Read(sql) || !reader.Read(fieldCount))
+            return false;
+
+        AddTables(sql);
+
+        Entry& entry = _entries[sql];
+        entry.Fields.resize(fieldCount);
+        for (uint32 f = 0; f < fieldCount; ++f)
+        {
+            QueryResultFieldMetadata& meta = entry.Fields[f];
+            uint8 type = 0;
+            if (!reader.Read(meta.TableName) || !reader.Read(meta.TableAlias) || !reader.Read(meta.Name) ||
+                !reader.Read(meta.Alias) || !reader.Read(meta.TypeName) || !reader.Read(type))
+                return false;
+
+            meta.Index = f;
+            meta.Type = DatabaseFieldTypes(type);
+        }
+
+        uint64 rowsSize = 0;
+        if (!reader.Read(entry.RowCount) || !reader.Read(rowsSize) || !reader.Skip(rowsSize, entry.Rows))
+            return false;
+
+        entry.RowsEnd = entry.Rows + rowsSize;
+        entry.Storage = region;
+    }
+
+    return reader.Remaining() == 0;
+}
+
+bool WorldDatabaseSnapshot::Save() const
+{
+    std::vector<char> payload;
+    SnapshotWriter writer(payload);
+    for (auto const& [sql, entry] : _entries)
+    {
+        writer.Write(std::string_view(sql));
+        writer.Write<uint32>(entry.Fields.size());
+        for (QueryResultFieldMetadata const& meta : entry.Fields)
+        {
+            writer.Write(std::string_view(meta.TableName));
+            writer.Write(std::string_view(meta.TableAlias));
+            writer.Write(std::string_view(meta.Name));
+            writer.Write(std::string_view(meta.Alias));
+            writer.Write(std::string_view(meta.TypeName));
+            writer.Write<uint8>(uint8(meta.Type));
+        }
+
+        writer.Write<uint64>(entry.RowCount);
+        writer.Write<uint64>(entry.RowsEnd - entry.Rows);
+        writer.Write(entry.Rows, entry.RowsEnd - entry.Rows);
+    }
+
+    std::vector<char> header;
+    SnapshotWriter headerWriter(header);
+    headerWriter.Write<uint32>(SNAPSHOT_MAGIC);
+    headerWriter.Write<uint32>(SNAPSHOT_VERSION);
+    headerWriter.Write(_key);
+    headerWriter.Write(Acore::Crypto::SHA1::GetDigestOf(reinterpret_cast<uint8 const*>(payload.data()), payload.size()));
+    headerWriter.Write<uint32>(_entries.size());
+    headerWriter.Write<uint64>(payload.size());
+    ASSERT(header.size() == SNAPSHOT_HEADER_SIZE);
+
+    // write next to the old file and swap, a crash while writing must not leave a damaged snapshot behind
+    std::string const tempPath = _path + ".tmp";
+    {
+        std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(header.data(), header.size()) || !file.write(payload.data(), payload.size()))
+        {
+            LOG_ERROR("server.loading", "Could not write world database snapshot {}.", tempPath);
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(tempPath, _path, error);
+    if (error)
+    {
+        LOG_ERROR("server.loading", "Could not replace world database snapshot {}: {}", _path, error.message());
+        std::filesystem::remove(tempPath, error);
+        return false;
+    }
+
+    return true;
+}
+
+WorldDatabaseSnapshot::Entry WorldDatabaseSnapshot::Capture(QueryResult const& result)
+{
+    Entry entry;
+    auto rows = std::make_shared<std::vector<char>>();
+    if (result)
+    {
+        SnapshotWriter writer(*rows);
+        for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+            entry.Fields.push_back(result->GetFieldMetadata(i));
+
+        do
+        {
+            Field* fields = result->Fetch();
+            for (uint32 i = 0; i < result->GetFieldCount(); ++i)
+            {
+                if (fields[i].IsNull())
+                {
+                    writer.Write<uint32>(ResultSet::SNAPSHOT_NULL_VALUE_LENGTH);
+                    continue;
+                }
+
+                std::string_view value = fields[i].Get<std::string_view>();
+                writer.Write<uint32>(value.size());
+                writer.Write(value.data(), value.size());
+                writer.Write<char>('\0');
+            }
+
+            ++entry.RowCount;
+        } while (result->NextRow());
+    }
+
+    entry.Rows = rows->data();
+    entry.RowsEnd = rows->data() + rows->size();
+    entry.Storage = std::move(rows);
+    return entry;
+}
+
+QueryResult WorldDatabaseSnapshot::MakeResult(Entry const& entry)
+{
+    if (!entry.RowCount)
+        return QueryResult(nullptr);
+
+    // same contract as DatabaseWorkerPool::Query, the result is positioned on its first row
+    QueryResult result = std::make_shared<ResultSet>(entry.Fields, entry.Rows, entry.RowsEnd, entry.RowCount, entry.Storage);
+    result->NextRow();
+    return result;
+}
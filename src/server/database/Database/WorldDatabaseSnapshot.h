@@ -0,0 +1,110 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _WORLD_DATABASE_SNAPSHOT_H
+#define _WORLD_DATABASE_SNAPSHOT_H
+
+#include "DatabaseEnvFwd.h"
+#include "Define.h"
+#include "Field.h"
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Binary snapshot of the results of the expensive world database queries issued at startup.
+ *
+ * The snapshot is keyed by a digest of the applied world database updates (the `updates` table
+ * maintained by DBUpdater). A restart with an unchanged update state maps the file and serves the
+ * captured rows to the unchanged loaders instead of querying MySQL. A missing, stale or damaged
+ * snapshot silently falls back to the database and a new snapshot is written by Finalize() once
+ * all loads succeeded.
+ *
+ * Writes of the server to a table read by a snapshotted query (GM commands spawning, moving or
+ * deleting creatures and gameobjects) delete the snapshot, see OnWrite(). Manual changes to the
+ * world database that bypass the server and the updates system are not detected, the snapshot
+ * file has to be deleted after such changes.
+ *
+ * Only used by the thread running the world startup, except for OnWrite().
+ */
+class AC_DATABASE_API WorldDatabaseSnapshot
+{
+public:
+    static constexpr uint32 SNAPSHOT_VERSION = 1;
+
+    using Digest = std::array<uint8, 20>;
+
+    static WorldDatabaseSnapshot* instance();
+
+    /// Validates and maps the snapshot at path, without a usable snapshot the results are captured for a new one
+    void Initialize(std::string path);
+    /// Writes the snapshot if new results were captured and releases all snapshot data
+    void Finalize();
+
+    /// Drop-in replacement of WorldDatabase.Query for the loaders using the snapshot
+    QueryResult Query(std::string_view sql);
+
+    /// Called by the world database connections for every executed write, deletes the snapshot when it writes a snapshotted table
+    void OnWrite(std::string_view sql);
+
+    [[nodiscard]] bool IsEnabled() const { return _enabled; }
+
+private:
+    WorldDatabaseSnapshot() = default;
+    ~WorldDatabaseSnapshot() = default;
+
+    struct Entry
+    {
+        std::vector<QueryResultFieldMetadata> Fields;
+        uint64 RowCount = 0;
+        char const* Rows = nullptr;
+        char const* RowsEnd = nullptr;
+        std::shared_ptr<void const> Storage;
+    };
+
+    static bool ComputeKey(Digest& key);
+    bool Open();
+    bool Save() const;
+    void AddTables(std::string_view sql);
+    void RemoveFile() const;
+    static Entry Capture(QueryResult const& result);
+    static QueryResult MakeResult(Entry const& entry);
+
+    std::string _path;
+    Digest _key{};
+    std::unordered_map<std::string, Entry> _entries;
+    bool _enabled = false;
+    bool _dirty = false;
+    uint32 _served = 0;
+    uint32 _captured = 0;
+
+    // tables read by the snapshotted queries, writes to them invalidate the snapshot
+    std::mutex _tablesLock;
+    std::unordered_set<std::string> _tables;
+    std::atomic<bool> _tracking = false;
+    std::atomic<bool> _invalidated = false;
+};
+
+#define sWorldDatabaseSnapshot WorldDatabaseSnapshot::instance()
+
+#endif // _WORLD_DATABASE_SNAPSHOT_H
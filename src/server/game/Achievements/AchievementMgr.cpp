@@ -840,6 +840,8 @@ void AchievementMgr::UpdateAchievementCriteria(AchievementCriteriaTypes type, ui
         case ACHIEVEMENT_CRITERIA_TYPE_LOOT_TYPE:
         case ACHIEVEMENT_CRITERIA_TYPE_CAST_SPELL2:
         case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
+        case ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA:
+        case ACHIEVEMENT_CRITERIA_TYPE_PLAY_ARENA:
             if (miscValue1)
             {
                 achievementCriteriaList = sAchievementMgr->GetSpecialAchievementCriteriaByType(type, miscValue1);
@@ -2667,6 +2669,12 @@ void AchievementGlobalMgr::LoadAchievementCriteriaList()
             case ACHIEVEMENT_CRITERIA_TYPE_LEARN_SKILL_LINE:
                 _specialList[criteria->requiredType][criteria->learn_skill_line.skillLine].push_back(criteria);
                 break;
+            case ACHIEVEMENT_CRITERIA_TYPE_WIN_ARENA:
+                _specialList[criteria->requiredType][criteria->win_arena.mapID].push_back(criteria);
+                break;
+            case ACHIEVEMENT_CRITERIA_TYPE_PLAY_ARENA:
+                _specialList[criteria->requiredType][criteria->play_arena.mapID].push_back(criteria);
+                break;
         }
 
         if (criteria->timeLimit)
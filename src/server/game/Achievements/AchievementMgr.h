@@ -26,11 +26,13 @@
 #include <chrono>
 #include <map>
 #include <string>
+#include <unordered_map>
 
 typedef std::list<AchievementCriteriaEntry const*> AchievementCriteriaEntryList;
 typedef std::list<AchievementEntry const*>         AchievementEntryList;
 
 typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByAchievement;
+typedef std::unordered_map<uint32, AchievementCriteriaEntryList> AchievementCriteriaListByMiscValue;
 typedef std::map<uint32, AchievementEntryList>         AchievementListByReferencedId;
 
 struct CriteriaProgress
@@ -337,18 +339,16 @@ public:
         return &_achievementCriteriasByType[type];
     }
 
-    AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetSpecialAchievementCriteriaByType(AchievementCriteriaTypes type, uint32 val) const
     {
-        if (_specialList[type].find(val) != _specialList[type].end())
-            return &_specialList[type][val];
-        return nullptr;
+        AchievementCriteriaListByMiscValue::const_iterator itr = _specialList[type].find(val);
+        return itr != _specialList[type].end() ? &itr->second : nullptr;
     }
 
-    AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val)
+    [[nodiscard]] AchievementCriteriaEntryList const* GetAchievementCriteriaByCondition(AchievementCriteriaCondition condition, uint32 val) const
     {
-        if (_achievementCriteriasByCondition[condition].find(val) != _achievementCriteriasByCondition[condition].end())
-            return &_achievementCriteriasByCondition[condition][val];
-        return nullptr;
+        AchievementCriteriaListByMiscValue::const_iterator itr = _achievementCriteriasByCondition[condition].find(val);
+        return itr != _achievementCriteriasByCondition[condition].end() ? &itr->second : nullptr;
     }
 
     [[nodiscard]] AchievementCriteriaEntryList const& GetTimedAchievementCriteriaByType(AchievementCriteriaTimedTypes type) const
@@ -416,8 +416,9 @@ private:
     AchievementRewardLocales _achievementRewardLocales;
 
     // pussywizard:
-    std::map<uint32, AchievementCriteriaEntryList> _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
-    std::map<uint32, AchievementCriteriaEntryList> _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
+    // store achievement criterias by type and the misc value an update has to match (creature entry, spell id, item id...)
+    AchievementCriteriaListByMiscValue _specialList[ACHIEVEMENT_CRITERIA_TYPE_TOTAL];
+    AchievementCriteriaListByMiscValue _achievementCriteriasByCondition[ACHIEVEMENT_CRITERIA_CONDITION_TOTAL];
 };
 
 #define sAchievementMgr AchievementGlobalMgr::instance()
@@ -18,16 +18,335 @@
 #include "CharacterCache.h"
 #include "ArenaTeam.h"
 #include "DatabaseEnv.h"
+#include "GameTime.h"
 #include "Log.h"
 #include "Player.h"
+#include "StringConvert.h"
 #include "Timer.h"
+#include "Tokenize.h"
 #include "World.h"
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace
 {
-    std::unordered_map<ObjectGuid, CharacterCacheEntry> _characterCacheStore;
-    std::unordered_map<std::string, CharacterCacheEntry*> _characterCacheByNameStore;
+    std::deque<CharacterCacheEntry> _characterCacheStore;                      // slots are reused after deletion, entries never move
+    std::vector<uint32> _characterCacheSlotByGuid;                             // [low guid] -> slot + 1, 0 if not cached
+    std::vector<uint32> _characterCacheFreeSlots;
+    std::unordered_multimap<uint32 /*folded name hash*/, uint32 /*slot*/> _characterCacheByNameStore;
+    uint32 _characterCacheCount = 0;
+    bool _characterCachePaged = false;
+
+    // paged mode: guids and folded names known not to exist, so repeated misses do not query the database again
+    constexpr std::size_t MAX_MISSING_CHARACTERS = 65536;
+    std::unordered_set<uint32> _characterCacheMissingGuids;
+    std::unordered_set<std::string> _characterCacheMissingNames;
+
+    // paged in entries are inserted by whichever thread looks them up, the Find/Create/Remove/Index helpers expect the caller to hold the lock
+    std::shared_mutex _characterCacheLock;
+
+    // set for the world and map update threads, see CharacterCache::WarnAboutSyncLoads
+    thread_local bool _warnSyncLoads = false;
+
+    char FoldNameChar(char c)
+    {
+        return (c >= 'A' && c <= 'Z') ? char(c - 'A' + 'a') : c;
+    }
+
+    uint32 HashCharacterName(std::string_view name)
+    {
+        // FNV-1a over the case folded name
+        uint32 hash = 2166136261u;
+        for (char c : name)
+            hash = (hash ^ uint8(FoldNameChar(c))) * 16777619u;
+
+        return hash;
+    }
+
+    std::string FoldCharacterName(std::string_view name)
+    {
+        std::string folded(name);
+        std::transform(folded.begin(), folded.end(), folded.begin(), FoldNameChar);
+        return folded;
+    }
+
+    bool EqualCharacterNames(std::string_view left, std::string_view right)
+    {
+        return left.size() == right.size() && std::equal(left.begin(), left.end(), right.begin(), [](char a, char b)
+        {
+            return FoldNameChar(a) == FoldNameChar(b);
+        });
+    }
+
+    CharacterCacheEntry* FindEntry(ObjectGuid const& guid)
+    {
+        uint32 lowGuid = guid.GetCounter();
+        if (lowGuid >= _characterCacheSlotByGuid.size() || !_characterCacheSlotByGuid[lowGuid])
+            return nullptr;
+
+        CharacterCacheEntry& entry = _characterCacheStore[_characterCacheSlotByGuid[lowGuid] - 1];
+        return entry.Guid == guid ? &entry : nullptr;
+    }
+
+    CharacterCacheEntry* FindEntryByName(std::string_view name)
+    {
+        auto bounds = _characterCacheByNameStore.equal_range(HashCharacterName(name));
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        {
+            CharacterCacheEntry& entry = _characterCacheStore[itr->second];
+            if (EqualCharacterNames(entry.Name, name))
+                return &entry;
+        }
+
+        return nullptr;
+    }
+
+    void IndexName(std::string_view name, uint32 slot)
+    {
+        _characterCacheByNameStore.emplace(HashCharacterName(name), slot);
+        if (!_characterCacheMissingNames.empty())
+            _characterCacheMissingNames.erase(FoldCharacterName(name));
+    }
+
+    bool IsMissing(ObjectGuid const& guid)
+    {
+        return _characterCacheMissingGuids.find(guid.GetCounter()) != _characterCacheMissingGuids.end();
+    }
+
+    bool IsMissing(std::string_view name)
+    {
+        return !_characterCacheMissingNames.empty() && _characterCacheMissingNames.find(FoldCharacterName(name)) != _characterCacheMissingNames.end();
+    }
+
+    /// Remembers a lookup that found no character, the sets are bounded as clients can make up guids and names
+    void MarkMissing(ObjectGuid const& guid)
+    {
+        if (FindEntry(guid))
+            return;
+
+        if (_characterCacheMissingGuids.size() >= MAX_MISSING_CHARACTERS)
+            _characterCacheMissingGuids.clear();
+
+        _characterCacheMissingGuids.insert(guid.GetCounter());
+    }
+
+    void MarkMissing(std::string_view name)
+    {
+        if (FindEntryByName(name))
+            return;
+
+        if (_characterCacheMissingNames.size() >= MAX_MISSING_CHARACTERS)
+            _characterCacheMissingNames.clear();
+
+        _characterCacheMissingNames.insert(FoldCharacterName(name));
+    }
+
+    void UnindexName(std::string_view name, uint32 slot)
+    {
+        auto bounds = _characterCacheByNameStore.equal_range(HashCharacterName(name));
+        for (auto itr = bounds.first; itr != bounds.second; ++itr)
+        {
+            if (itr->second == slot)
+            {
+                _characterCacheByNameStore.erase(itr);
+                return;
+            }
+        }
+    }
+
+    /// Returns the entry of guid, a new zeroed entry if the guid was not cached yet
+    CharacterCacheEntry& CreateEntry(ObjectGuid const& guid)
+    {
+        uint32 lowGuid = guid.GetCounter();
+        if (lowGuid >= _characterCacheSlotByGuid.size())
+            _characterCacheSlotByGuid.resize(lowGuid + 1, 0);
+
+        if (uint32 slot = _characterCacheSlotByGuid[lowGuid])
+        {
+            CharacterCacheEntry& entry = _characterCacheStore[slot - 1];
+            UnindexName(entry.Name, slot - 1);
+            return entry;
+        }
+
+        uint32 slot;
+        if (!_characterCacheFreeSlots.empty())
+        {
+            slot = _characterCacheFreeSlots.back();
+            _characterCacheFreeSlots.pop_back();
+            _characterCacheStore[slot] = CharacterCacheEntry();
+        }
+        else
+        {
+            slot = uint32(_characterCacheStore.size());
+            _characterCacheStore.emplace_back();
+        }
+
+        _characterCacheSlotByGuid[lowGuid] = slot + 1;
+        _characterCacheMissingGuids.erase(lowGuid);
+        ++_characterCacheCount;
+        return _characterCacheStore[slot];
+    }
+
+    void RemoveEntry(ObjectGuid const& guid)
+    {
+        if (!FindEntry(guid))
+            return;
+
+        uint32 slot = _characterCacheSlotByGuid[guid.GetCounter()] - 1;
+        CharacterCacheEntry& entry = _characterCacheStore[slot];
+        UnindexName(entry.Name, slot);
+        entry = CharacterCacheEntry();
+
+        _characterCacheSlotByGuid[guid.GetCounter()] = 0;
+        _characterCacheFreeSlots.push_back(slot);
+        --_characterCacheCount;
+    }
+
+    CharacterCacheEntry& AddEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
+    {
+        CharacterCacheEntry& data = CreateEntry(guid);
+        data.Guid = guid;
+        data.Name = name;
+        data.AccountId = accountId;
+        data.Race = race;
+        data.Sex = gender;
+        data.Class = playerClass;
+        data.Level = level;
+        data.GuildId = 0;                           // Will be set in guild loading or guild setting
+        for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
+        {
+            data.ArenaTeamId[i] = 0; // Will be set in arena teams loading
+        }
+
+        // Fill Name to Guid Store
+        IndexName(name, _characterCacheSlotByGuid[guid.GetCounter()] - 1);
+        return data;
+    }
+
+    /// Copy of an entry, taken while the caller holds the lock as the setters may change the entry afterwards
+    Optional<CharacterCacheEntry> CopyEntry(CharacterCacheEntry const* entry)
+    {
+        if (!entry)
+            return {};
+
+        return *entry;
+    }
+
+    /// Creates the entry of a paged in character from a CHAR_SEL_CHARACTER_CACHE_BY_* row
+    Optional<CharacterCacheEntry> LoadEntry(PreparedQueryResult const& result)
+    {
+        if (!result)
+            return {};
+
+        Field* fields = result->Fetch();
+        ObjectGuid guid = ObjectGuid::Create<HighGuid::Player>(fields[0].Get<uint32>());
+
+        std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+
+        // loaded meanwhile, the cached entry is at least as recent as the database
+        if (CharacterCacheEntry* entry = FindEntry(guid))
+            return *entry;
+
+        CharacterCacheEntry* entry = &AddEntry(guid, fields[2].Get<uint32>() /*account*/, fields[1].Get<std::string>() /*name*/,
+            fields[4].Get<uint8>() /*gender*/, fields[3].Get<uint8>() /*race*/, fields[5].Get<uint8>() /*class*/, fields[6].Get<uint8>() /*level*/);
+        entry->GuildId = fields[7].Get<uint32>();
+        entry->GroupGuid = fields[8].Get<uint32>() ? ObjectGuid::Create<HighGuid::Group>(fields[8].Get<uint32>()) : ObjectGuid::Empty;
+        entry->MailCount = uint8(std::min<uint64>(fields[9].Get<uint64>(), std::numeric_limits<uint8>::max()));
+
+        // pairs of arena team type and id
+        std::vector<std::string_view> arenaTeams = Acore::Tokenize(fields[10].Get<std::string_view>(), ' ', false);
+        for (std::size_t i = 0; i + 1 < arenaTeams.size(); i += 2)
+        {
+            uint8 slot = ArenaTeam::GetSlotByType(Acore::StringTo<uint32>(arenaTeams[i]).value_or(0));
+            if (slot < MAX_ARENA_SLOT)
+                entry->ArenaTeamId[slot] = Acore::StringTo<uint32>(arenaTeams[i + 1]).value_or(0);
+        }
+
+        return *entry;
+    }
+
+    Optional<CharacterCacheEntry> LoadEntry(ObjectGuid const& guid, PreparedQueryResult const& result)
+    {
+        if (result)
+            return LoadEntry(result);
+
+        std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+        MarkMissing(guid);
+        return CopyEntry(FindEntry(guid));
+    }
+
+    Optional<CharacterCacheEntry> LoadEntry(std::string const& name, PreparedQueryResult const& result)
+    {
+        Optional<CharacterCacheEntry> entry = LoadEntry(result);
+
+        // also covers names the database collation matches but the case folding of the cache does not,
+        // they must not be queried again
+        std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+        MarkMissing(name);
+        return entry ? entry : CopyEntry(FindEntryByName(name));
+    }
+
+    /// True if the lookup of guid does not need the database
+    bool IsLoaded(ObjectGuid const& guid)
+    {
+        if (!_characterCachePaged || !guid.IsPlayer())
+            return true;
+
+        std::shared_lock<std::shared_mutex> lock(_characterCacheLock);
+        return FindEntry(guid) || IsMissing(guid);
+    }
+
+    bool IsLoaded(std::string const& name)
+    {
+        if (!_characterCachePaged || name.empty())
+            return true;
+
+        std::shared_lock<std::shared_mutex> lock(_characterCacheLock);
+        return FindEntryByName(name) || IsMissing(name);
+    }
+
+    Optional<CharacterCacheEntry> GetEntry(ObjectGuid const& guid)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(_characterCacheLock);
+            if (CharacterCacheEntry const* entry = FindEntry(guid))
+                return *entry;
+
+            if (!_characterCachePaged || !guid.IsPlayer() || IsMissing(guid))
+                return {};
+        }
+
+        // synchronous fallback for callers that were not preloaded or deferred, see LoadCharacterCacheStorage and LoadCharacterCacheEntryAsync
+        if (_warnSyncLoads)
+            LOG_WARN("sql.performances", "CharacterCache: character {} was not paged in, the world or a map waits for its synchronous load", guid.ToString());
+
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_GUID);
+        stmt->SetData(0, guid.GetCounter());
+        return LoadEntry(guid, CharacterDatabase.Query(stmt));
+    }
+
+    Optional<CharacterCacheEntry> GetEntryByName(std::string const& name)
+    {
+        {
+            std::shared_lock<std::shared_mutex> lock(_characterCacheLock);
+            if (CharacterCacheEntry const* entry = FindEntryByName(name))
+                return *entry;
+
+            if (!_characterCachePaged || name.empty() || IsMissing(name))
+                return {};
+        }
+
+        if (_warnSyncLoads)
+            LOG_WARN("sql.performances", "CharacterCache: character {} was not paged in, the world or a map waits for its synchronous load", name);
+
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_NAME);
+        stmt->SetData(0, name);
+        return LoadEntry(name, CharacterDatabase.Query(stmt));
+    }
 }
 
 CharacterCache* CharacterCache::instance()
@@ -45,7 +364,7 @@ CharacterCache* CharacterCache::instance()
 * @return Name, Gender, Race, Class and Level of player character
 * Example Usage:
 * @code
-*    CharacterCacheEntry const* characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
+*    Optional<CharacterCacheEntry> characterInfo = sCharacterCache->GetCharacterCacheByGuid(GUID);
 *    if (!characterInfo)
 *        return;
 *
@@ -59,10 +378,32 @@ CharacterCache* CharacterCache::instance()
 
 void CharacterCache::LoadCharacterCacheStorage()
 {
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
     _characterCacheStore.clear();
+    _characterCacheSlotByGuid.clear();
+    _characterCacheFreeSlots.clear();
+    _characterCacheByNameStore.clear();
+    _characterCacheMissingGuids.clear();
+    _characterCacheMissingNames.clear();
+    _characterCacheCount = 0;
+    _characterCachePaged = sWorld->getBoolConfig(CONFIG_CHARACTER_CACHE_PAGED);
     uint32 oldMSTime = getMSTime();
 
-    QueryResult result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
+    QueryResult result;
+    if (_characterCachePaged)
+    {
+        // keep the recently active characters resident, all others are paged in on demand
+        // also preload the characters the startup loaders and the world thread look up in bulk (auction sorting by owner,
+        // guild rosters, groups, arena teams, calendar, corpse expiry), they would otherwise be loaded one query at a time
+        uint32 residentSince = uint32(GameTime::GetGameTime().count()) - std::min<uint32>(uint32(GameTime::GetGameTime().count()), sWorld->getIntConfig(CONFIG_CHARACTER_CACHE_RESIDENT_DAYS) * DAY);
+        result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters WHERE logout_time >= {} OR online <> 0 "
+            "OR guid IN (SELECT itemowner FROM auctionhouse) OR guid IN (SELECT buyguid FROM auctionhouse) "
+            "OR guid IN (SELECT guid FROM guild_member) OR guid IN (SELECT memberGuid FROM group_member) OR guid IN (SELECT guid FROM arena_team_member) "
+            "OR guid IN (SELECT creator FROM calendar_events) OR guid IN (SELECT invitee FROM calendar_invites) OR guid IN (SELECT guid FROM corpse)", residentSince);
+    }
+    else
+        result = CharacterDatabase.Query("SELECT guid, name, account, race, gender, class, level FROM characters");
+
     if (!result)
     {
         LOG_INFO("server.loading", "No character name data loaded, empty query!");
@@ -72,7 +413,7 @@ void CharacterCache::LoadCharacterCacheStorage()
     do
     {
         Field* fields = result->Fetch();
-        AddCharacterCacheEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].Get<uint32>()) /*guid*/, fields[2].Get<uint32>() /*account*/, fields[1].Get<std::string>() /*name*/,
+        AddEntry(ObjectGuid::Create<HighGuid::Player>(fields[0].Get<uint32>()) /*guid*/, fields[2].Get<uint32>() /*account*/, fields[1].Get<std::string>() /*name*/,
             fields[4].Get<uint8>() /*gender*/, fields[3].Get<uint8>() /*race*/, fields[5].Get<uint8>() /*class*/, fields[6].Get<uint8>() /*level*/);
     } while (result->NextRow());
 
@@ -82,11 +423,12 @@ void CharacterCache::LoadCharacterCacheStorage()
         do
         {
             Field* fields = mailCountResult->Fetch();
-            UpdateCharacterMailCount(ObjectGuid(HighGuid::Player, fields[0].Get<uint32>()), static_cast<int8>(fields[1].Get<uint64>()), true);
+            if (CharacterCacheEntry* entry = FindEntry(ObjectGuid(HighGuid::Player, fields[0].Get<uint32>())))
+                entry->MailCount = static_cast<int8>(fields[1].Get<uint64>());
         } while (mailCountResult->NextRow());
     }
 
-    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters in {} ms", _characterCacheStore.size(), GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", ">> Loaded Character Infos For {} Characters{} in {} ms", _characterCacheCount, _characterCachePaged ? " (paged)" : "", GetMSTimeDiffToNow(oldMSTime));
     LOG_INFO("server.loading", " ");
 }
 
@@ -121,133 +463,105 @@ Modifying functions
 */
 void CharacterCache::AddCharacterCacheEntry(ObjectGuid const& guid, uint32 accountId, std::string const& name, uint8 gender, uint8 race, uint8 playerClass, uint8 level)
 {
-    CharacterCacheEntry& data = _characterCacheStore[guid];
-    data.Guid = guid;
-    data.Name = name;
-    data.AccountId = accountId;
-    data.Race = race;
-    data.Sex = gender;
-    data.Class = playerClass;
-    data.Level = level;
-    data.GuildId = 0;                           // Will be set in guild loading or guild setting
-    for (uint8 i = 0; i < MAX_ARENA_SLOT; ++i)
-    {
-        data.ArenaTeamId[i] = 0; // Will be set in arena teams loading
-    }
-
-    // Fill Name to Guid Store
-    _characterCacheByNameStore[name] = &data;
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    AddEntry(guid, accountId, name, gender, race, playerClass, level);
 }
 
-void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& name)
+void CharacterCache::DeleteCharacterCacheEntry(ObjectGuid const& guid, std::string const& /*name*/)
 {
-    _characterCacheStore.erase(guid);
-    _characterCacheByNameStore.erase(name);
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    RemoveEntry(guid);
 }
 
 void CharacterCache::UpdateCharacterData(ObjectGuid const& guid, std::string const& name, Optional<uint8> gender /*= {}*/, Optional<uint8> race /*= {}*/)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+
+    // the new name exists now, even if the renamed character is not paged in
+    _characterCacheMissingNames.erase(FoldCharacterName(name));
+
+    CharacterCacheEntry* entry = FindEntry(guid);
+    if (!entry)
         return;
 
-    std::string oldName = itr->second.Name;
-    itr->second.Name = name;
+    uint32 slot = _characterCacheSlotByGuid[guid.GetCounter()] - 1;
+    UnindexName(entry->Name, slot);
+    entry->Name = name;
 
     if (gender)
     {
-        itr->second.Sex = *gender;
+        entry->Sex = *gender;
     }
 
     if (race)
     {
-        itr->second.Race = *race;
+        entry->Race = *race;
     }
 
     //WorldPackets::Misc::InvalidatePlayer packet(guid);
     //sWorld->SendGlobalMessage(packet.Write());
 
-    // Correct name -> pointer storage
-    _characterCacheByNameStore.erase(oldName);
-    _characterCacheByNameStore[name] = &itr->second;
+    // Correct name -> slot storage
+    IndexName(name, slot);
 }
 
 void CharacterCache::UpdateCharacterLevel(ObjectGuid const& guid, uint8 level)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.Level = level;
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    if (CharacterCacheEntry* entry = FindEntry(guid))
+        entry->Level = level;
 }
 
 void CharacterCache::UpdateCharacterAccountId(ObjectGuid const& guid, uint32 accountId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.AccountId = accountId;
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    if (CharacterCacheEntry* entry = FindEntry(guid))
+        entry->AccountId = accountId;
 }
 
 void CharacterCache::UpdateCharacterGuildId(ObjectGuid const& guid, ObjectGuid::LowType guildId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.GuildId = guildId;
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    if (CharacterCacheEntry* entry = FindEntry(guid))
+        entry->GuildId = guildId;
 }
 
 void CharacterCache::UpdateCharacterArenaTeamId(ObjectGuid const& guid, uint8 slot, uint32 arenaTeamId)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.ArenaTeamId[slot] = arenaTeamId;
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    if (CharacterCacheEntry* entry = FindEntry(guid))
+        entry->ArenaTeamId[slot] = arenaTeamId;
 }
 
 void CharacterCache::UpdateCharacterMailCount(ObjectGuid const& guid, int8 count, bool update)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    CharacterCacheEntry* entry = FindEntry(guid);
+    if (!entry)
     {
         return;
     }
 
     if (update)
     {
-        itr->second.MailCount = count;
+        entry->MailCount = count;
         return;
     }
 
     // Let's be safe and prevent overflow
-    if (!itr->second.MailCount && count < 0)
+    if (!entry->MailCount && count < 0)
     {
         return;
     }
 
-    itr->second.MailCount += count;
+    entry->MailCount += count;
 }
 
 void CharacterCache::UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID)
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return;
-    }
-
-    itr->second.GroupGuid = groupGUID;
+    std::unique_lock<std::shared_mutex> lock(_characterCacheLock);
+    if (CharacterCacheEntry* entry = FindEntry(guid))
+        entry->GroupGuid = groupGUID;
 }
 
 /*
@@ -255,127 +569,129 @@ Getters
 */
 bool CharacterCache::HasCharacterCacheEntry(ObjectGuid const& guid) const
 {
-    return _characterCacheStore.find(guid) != _characterCacheStore.end();
+    return GetEntry(guid).has_value();
+}
+
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
+{
+    return GetEntry(guid);
+}
+
+Optional<CharacterCacheEntry> CharacterCache::GetCharacterCacheByName(std::string const& name) const
+{
+    return GetEntryByName(name);
+}
+
+bool CharacterCache::IsPaged() const
+{
+    return _characterCachePaged;
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByGuid(ObjectGuid const& guid) const
+void CharacterCache::WarnAboutSyncLoads(bool warn) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr != _characterCacheStore.end())
+    _warnSyncLoads = warn;
+}
+
+bool CharacterCache::IsCharacterCacheEntryLoaded(ObjectGuid const& guid) const
+{
+    return IsLoaded(guid);
+}
+
+bool CharacterCache::IsCharacterCacheEntryLoaded(std::string const& name) const
+{
+    return IsLoaded(name);
+}
+
+void CharacterCache::LoadCharacterCacheEntryAsync(ObjectGuid const& guid, QueryCallbackProcessor& processor, std::function<void(Optional<CharacterCacheEntry> const&)>&& callback) const
+{
+    if (IsLoaded(guid))
     {
-        return &itr->second;
+        callback(GetEntry(guid));
+        return;
     }
 
-    return nullptr;
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_GUID);
+    stmt->SetData(0, guid.GetCounter());
+    processor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([guid, callback = std::move(callback)](PreparedQueryResult result)
+    {
+        callback(LoadEntry(guid, result));
+    }));
 }
 
-CharacterCacheEntry const* CharacterCache::GetCharacterCacheByName(std::string const& name) const
+void CharacterCache::LoadCharacterCacheEntryAsync(std::string const& name, QueryCallbackProcessor& processor, std::function<void(Optional<CharacterCacheEntry> const&)>&& callback) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
+    if (IsLoaded(name))
     {
-        return itr->second;
+        callback(GetEntryByName(name));
+        return;
     }
 
-    return nullptr;
+    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHARACTER_CACHE_BY_NAME);
+    stmt->SetData(0, name);
+    processor.AddCallback(CharacterDatabase.AsyncQuery(stmt).WithPreparedCallback([name, callback = std::move(callback)](PreparedQueryResult result)
+    {
+        callback(LoadEntry(name, result));
+    }));
 }
 
 ObjectGuid CharacterCache::GetCharacterGuidByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second->Guid;
-    }
+    if (Optional<CharacterCacheEntry> entry = GetEntryByName(name))
+        return entry->Guid;
 
     return ObjectGuid::Empty;
 }
 
 bool CharacterCache::GetCharacterNameByGuid(ObjectGuid guid, std::string& name) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    if (!entry)
     {
         return false;
     }
 
-    name = itr->second.Name;
+    name = entry->Name;
     return true;
 }
 
 uint32 CharacterCache::GetCharacterTeamByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return Player::TeamIdForRace(itr->second.Race);
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    return entry ? Player::TeamIdForRace(entry->Race) : 0;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.AccountId;
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    return entry ? entry->AccountId : 0;
 }
 
 uint32 CharacterCache::GetCharacterAccountIdByName(std::string const& name) const
 {
-    auto itr = _characterCacheByNameStore.find(name);
-    if (itr != _characterCacheByNameStore.end())
-    {
-        return itr->second->AccountId;
-    }
-
-    return 0;
+    Optional<CharacterCacheEntry> entry = GetEntryByName(name);
+    return entry ? entry->AccountId : 0;
 }
 
 uint8 CharacterCache::GetCharacterLevelByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.Level;
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    return entry ? entry->Level : 0;
 }
 
 ObjectGuid::LowType CharacterCache::GetCharacterGuildIdByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.GuildId;
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    return entry ? entry->GuildId : 0;
 }
 
 uint32 CharacterCache::GetCharacterArenaTeamIdByGuid(ObjectGuid guid, uint8 type) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return 0;
-    }
-
-    return itr->second.ArenaTeamId[type];
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    return entry ? entry->ArenaTeamId[type] : 0;
 }
 
 ObjectGuid CharacterCache::GetCharacterGroupGuidByGuid(ObjectGuid guid) const
 {
-    auto itr = _characterCacheStore.find(guid);
-    if (itr == _characterCacheStore.end())
-    {
-        return ObjectGuid::Empty;
-    }
-
-    return itr->second.GroupGuid;
+    Optional<CharacterCacheEntry> entry = GetEntry(guid);
+    return entry ? entry->GroupGuid : ObjectGuid::Empty;
 }
@@ -19,9 +19,11 @@
 #define CharacterCache_h__
 
 #include "ArenaTeam.h"
+#include "DatabaseEnvFwd.h"
 #include "Define.h"
 #include "ObjectGuid.h"
 #include "Optional.h"
+#include <functional>
 #include <string>
 
 struct CharacterCacheEntry
@@ -39,6 +41,17 @@ struct CharacterCacheEntry
     ObjectGuid GroupGuid;
 };
 
+/**
+ * Entries are stored in a flat table indexed by the low guid, names are only kept in the entries
+ * and looked up through a case insensitive name hash.
+ *
+ * With CharacterCache.Paged only recently active characters and the characters referenced by auctions,
+ * guilds, groups, arena teams, the calendar and corpses are loaded on startup. All other entries are loaded
+ * from the database the first time they are looked up and stay loaded afterwards, lookups that found no
+ * character are remembered. Packet handlers should page entries in with LoadCharacterCacheEntryAsync(),
+ * the getters fall back to a synchronous query.
+ * Getters return copies taken under the cache lock, other threads may update or remove the entry meanwhile.
+ */
 class AC_GAME_API CharacterCache
 {
     public:
@@ -63,8 +76,18 @@ class AC_GAME_API CharacterCache
         void IncreaseCharacterMailCount(ObjectGuid const& guid) { UpdateCharacterMailCount(guid, 1); };
 
         [[nodiscard]] bool HasCharacterCacheEntry(ObjectGuid const& guid) const;
-        [[nodiscard]] CharacterCacheEntry const* GetCharacterCacheByGuid(ObjectGuid const& guid) const;
-        [[nodiscard]] CharacterCacheEntry const* GetCharacterCacheByName(std::string const& name) const;
+        [[nodiscard]] Optional<CharacterCacheEntry> GetCharacterCacheByGuid(ObjectGuid const& guid) const;
+        [[nodiscard]] Optional<CharacterCacheEntry> GetCharacterCacheByName(std::string const& name) const;
+
+        [[nodiscard]] bool IsPaged() const;
+        /// Logs every entry the calling thread has to load synchronously, set for the world and map update threads
+        void WarnAboutSyncLoads(bool warn) const;
+        /// True if the entry (or its absence) is known without a database lookup, always true for a cache that is not paged
+        [[nodiscard]] bool IsCharacterCacheEntryLoaded(ObjectGuid const& guid) const;
+        [[nodiscard]] bool IsCharacterCacheEntryLoaded(std::string const& name) const;
+        /// Loads the entry of a character without blocking, callback receives a copy of the entry or nothing if the character does not exist
+        void LoadCharacterCacheEntryAsync(ObjectGuid const& guid, QueryCallbackProcessor& processor, std::function<void(Optional<CharacterCacheEntry> const&)>&& callback) const;
+        void LoadCharacterCacheEntryAsync(std::string const& name, QueryCallbackProcessor& processor, std::function<void(Optional<CharacterCacheEntry> const&)>&& callback) const;
 
         void UpdateCharacterGroup(ObjectGuid const& guid, ObjectGuid groupGUID);
         void ClearCharacterGroup(ObjectGuid const& guid) { UpdateCharacterGroup(guid, ObjectGuid::Empty); };
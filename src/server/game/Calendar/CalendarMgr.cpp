@@ -23,6 +23,7 @@
 #include "Opcodes.h"
 #include "Player.h"
 #include "QueryResult.h"
+#include <algorithm>
 #include <unordered_map>
 
 CalendarInvite::CalendarInvite() : _inviteId(1), _eventId(0), _statusTime(GameTime::GetGameTime().count()),
@@ -88,6 +89,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarEvent* calendarEvent = new CalendarEvent(eventId, creatorGUID, guildId, type, dungeonId, time_t(eventTime), flags, time_t(timezoneTime), title, description);
             _events.insert(calendarEvent);
+            IndexEvent(calendarEvent);
 
             _maxEventId = std::max(_maxEventId, eventId);
 
@@ -114,6 +116,7 @@ void CalendarMgr::LoadFromDB()
 
             CalendarInvite* invite = new CalendarInvite(inviteId, eventId, invitee, senderGUID, time_t(statusTime), status, rank, text);
             _invites[eventId].push_back(invite);
+            IndexInvite(invite);
 
             _maxInviteId = std::max(_maxInviteId, inviteId);
 
@@ -135,6 +138,7 @@ void CalendarMgr::LoadFromDB()
 void CalendarMgr::AddEvent(CalendarEvent* calendarEvent, CalendarSendEventType sendType)
 {
     _events.insert(calendarEvent);
+    IndexEvent(calendarEvent);
     UpdateEvent(calendarEvent);
     SendCalendarEvent(calendarEvent->GetCreatorGUID(), *calendarEvent, sendType);
 }
@@ -150,6 +154,7 @@ void CalendarMgr::AddInvite(CalendarEvent* calendarEvent, CalendarInvite* invite
     if (!calendarEvent->IsGuildAnnouncement())
     {
         _invites[invite->GetEventId()].push_back(invite);
+        IndexInvite(invite);
         UpdateInvite(invite, trans);
     }
 }
@@ -194,6 +199,7 @@ void CalendarMgr::RemoveEvent(CalendarEvent* calendarEvent, ObjectGuid remover)
         if (remover && invite->GetInviteeGUID() != remover)
             mail.SendMailTo(trans, MailReceiver(invite->GetInviteeGUID().GetCounter()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+        UnindexInvite(invite);
         delete invite;
     }
 
@@ -205,6 +211,7 @@ void CalendarMgr::RemoveEvent(CalendarEvent* calendarEvent, ObjectGuid remover)
     CharacterDatabase.CommitTransaction(trans);
 
     _events.erase(calendarEvent);
+    UnindexEvent(calendarEvent);
     delete calendarEvent;
     return;
 }
@@ -240,6 +247,7 @@ void CalendarMgr::RemoveInvite(uint64 inviteId, uint64 eventId, ObjectGuid /*rem
     //    MailDraft(calendarEvent->BuildCalendarMailSubject(remover), calendarEvent->BuildCalendarMailBody())
     //        .SendMailTo(trans, MailReceiver((*itr)->GetInvitee()), calendarEvent, MAIL_CHECK_MASK_COPIED);
 
+    UnindexInvite(*itr);
     delete *itr;
     _invites[eventId].erase(itr);
 }
@@ -304,13 +312,53 @@ void CalendarMgr::RemovePlayerGuildEventsAndSignups(ObjectGuid guid, uint32 guil
                 RemoveInvite((*itr)->GetInviteId(), (*itr)->GetEventId(), guid);
 }
 
-CalendarEvent* CalendarMgr::GetEvent(uint64 eventId)
+void CalendarMgr::IndexEvent(CalendarEvent* calendarEvent)
 {
-    for (CalendarEventStore::iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->GetEventId() == eventId)
-            return *itr;
+    _eventsById[calendarEvent->GetEventId()] = calendarEvent;
 
-    return nullptr;
+    if (calendarEvent->GetGuildId())
+        _guildEvents[calendarEvent->GetGuildId()].insert(calendarEvent);
+}
+
+void CalendarMgr::UnindexEvent(CalendarEvent* calendarEvent)
+{
+    auto itr = _eventsById.find(calendarEvent->GetEventId());
+    if (itr != _eventsById.end() && itr->second == calendarEvent)
+        _eventsById.erase(itr);
+
+    if (calendarEvent->GetGuildId())
+    {
+        auto guildItr = _guildEvents.find(calendarEvent->GetGuildId());
+        if (guildItr != _guildEvents.end())
+        {
+            guildItr->second.erase(calendarEvent);
+            if (guildItr->second.empty())
+                _guildEvents.erase(guildItr);
+        }
+    }
+}
+
+void CalendarMgr::IndexInvite(CalendarInvite* invite)
+{
+    _playerInvites[invite->GetInviteeGUID()].push_back(invite);
+}
+
+void CalendarMgr::UnindexInvite(CalendarInvite* invite)
+{
+    auto itr = _playerInvites.find(invite->GetInviteeGUID());
+    if (itr == _playerInvites.end())
+        return;
+
+    CalendarInviteStore& invites = itr->second;
+    invites.erase(std::remove(invites.begin(), invites.end(), invite), invites.end());
+    if (invites.empty())
+        _playerInvites.erase(itr);
+}
+
+CalendarEvent* CalendarMgr::GetEvent(uint64 eventId)
+{
+    auto itr = _eventsById.find(eventId);
+    return itr != _eventsById.end() ? itr->second : nullptr;
 }
 
 CalendarInvite* CalendarMgr::GetInvite(uint64 inviteId) const
@@ -390,10 +438,13 @@ CalendarEventStore CalendarMgr::GetGuildEvents(uint32 guildId)
     if (!guildId)
         return result;
 
-    for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-        if ((*itr)->IsGuildEvent() || (*itr)->IsGuildAnnouncement())
-            if ((*itr)->GetGuildId() == guildId)
-                result.insert(*itr);
+    auto itr = _guildEvents.find(guildId);
+    if (itr == _guildEvents.end())
+        return result;
+
+    for (CalendarEvent* calendarEvent : itr->second)
+        if (calendarEvent->IsGuildEvent() || calendarEvent->IsGuildAnnouncement())
+            result.insert(calendarEvent);
 
     return result;
 }
@@ -402,17 +453,19 @@ CalendarEventStore CalendarMgr::GetPlayerEvents(ObjectGuid guid)
 {
     CalendarEventStore events;
 
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                if (CalendarEvent* event = GetEvent(itr->first)) // nullptr check added as attempt to fix #11512
-                    events.insert(event);
+    auto itr = _playerInvites.find(guid);
+    if (itr != _playerInvites.end())
+        for (CalendarInvite* invite : itr->second)
+            if (CalendarEvent* event = GetEvent(invite->GetEventId())) // nullptr check added as attempt to fix #11512
+                events.insert(event);
 
     if (Player* player = ObjectAccessor::FindConnectedPlayer(guid))
         if (player->GetGuildId())
-            for (CalendarEventStore::const_iterator itr = _events.begin(); itr != _events.end(); ++itr)
-                if ((*itr)->GetGuildId() == player->GetGuildId())
-                    events.insert(*itr);
+        {
+            auto guildItr = _guildEvents.find(player->GetGuildId());
+            if (guildItr != _guildEvents.end())
+                events.insert(guildItr->second.begin(), guildItr->second.end());
+        }
 
     return events;
 }
@@ -424,19 +477,20 @@ CalendarInviteStore const& CalendarMgr::GetEventInvites(uint64 eventId)
 
 CalendarInviteStore CalendarMgr::GetPlayerInvites(ObjectGuid guid)
 {
-    CalendarInviteStore invites;
+    auto itr = _playerInvites.find(guid);
+    if (itr == _playerInvites.end())
+        return CalendarInviteStore();
 
-    for (CalendarEventInviteStore::const_iterator itr = _invites.begin(); itr != _invites.end(); ++itr)
-        for (CalendarInviteStore::const_iterator itr2 = itr->second.begin(); itr2 != itr->second.end(); ++itr2)
-            if ((*itr2)->GetInviteeGUID() == guid)
-                invites.push_back(*itr2);
-
-    return invites;
+    return itr->second;
 }
 
 uint32 CalendarMgr::GetPlayerNumPending(ObjectGuid guid)
 {
-    CalendarInviteStore const& invites = GetPlayerInvites(guid);
+    auto playerItr = _playerInvites.find(guid);
+    if (playerItr == _playerInvites.end())
+        return 0;
+
+    CalendarInviteStore const& invites = playerItr->second;
 
     uint32 pendingNum = 0;
     for (CalendarInviteStore::const_iterator itr = invites.begin(); itr != invites.end(); ++itr)
@@ -273,6 +273,8 @@ private:
 typedef std::vector<CalendarInvite*> CalendarInviteStore;
 typedef std::unordered_set<CalendarEvent*> CalendarEventStore;
 typedef std::unordered_map<uint64 /* eventId */, CalendarInviteStore > CalendarEventInviteStore;
+typedef std::unordered_map<ObjectGuid /* invitee */, CalendarInviteStore> CalendarPlayerInviteStore;
+typedef std::unordered_map<uint32 /* guildId */, CalendarEventStore> CalendarGuildEventStore;
 
 class CalendarMgr
 {
@@ -283,6 +285,16 @@ private:
     CalendarEventStore _events;
     CalendarEventInviteStore _invites;
 
+    // lookup indexes over _events and _invites, kept in sync by the Index/Unindex helpers below
+    std::unordered_map<uint64 /* eventId */, CalendarEvent*> _eventsById;
+    CalendarPlayerInviteStore _playerInvites;
+    CalendarGuildEventStore _guildEvents;
+
+    void IndexEvent(CalendarEvent* calendarEvent);
+    void UnindexEvent(CalendarEvent* calendarEvent);
+    void IndexInvite(CalendarInvite* invite);
+    void UnindexInvite(CalendarInvite* invite);
+
     std::deque<uint64> _freeEventIds;
     std::deque<uint64> _freeInviteIds;
     uint64 _maxEventId;
@@ -301,11 +301,23 @@ void ThreatContainer::ModifyThreatByPercent(Unit* victim, int32 percent)
 
 //============================================================
 // Check if the list is dirty and sort if necessary
+// The list stays ordered between updates, so only the entries whose threat changed are out of place:
+// each of them is moved to its new position in the already sorted prefix (stable, equal threat keeps the old order)
 
 void ThreatContainer::update()
 {
     if (iDirty && iThreatList.size() > 1)
-        iThreatList.sort(Acore::ThreatOrderPred());
+    {
+        Acore::ThreatOrderPred pred;
+        for (StorageType::iterator itr = iThreatList.begin() + 1; itr != iThreatList.end(); ++itr)
+        {
+            if (!pred(*itr, *(itr - 1)))
+                continue;
+
+            StorageType::iterator position = std::upper_bound(iThreatList.begin(), itr, *itr, pred);
+            std::rotate(position, itr, itr + 1);
+        }
+    }
 
     iDirty = false;
 }
@@ -654,8 +666,10 @@ void ThreatMgr::ResetAllThreat()
     if (threatList.empty())
         return;
 
-    for (HostileReference* ref : threatList)
+    // indexed loop, threat changes may append new references (pet owners) to the list
+    for (std::size_t i = 0; i < threatList.size(); ++i)
     {
+        HostileReference* ref = threatList[i];
         // Reset temp threat before setting threat back to 0.
         ref->resetTempThreat();
         ref->SetThreat(0.f);
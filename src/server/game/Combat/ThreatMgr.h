@@ -24,7 +24,8 @@
 #include "Reference.h"
 #include "SharedDefines.h"
 #include "UnitEvents.h"
-#include <list>
+#include <algorithm>
+#include <vector>
 
 //==============================================================
 
@@ -145,7 +146,8 @@ class ThreatContainer
     friend class ThreatMgr;
 
 public:
-    typedef std::list<HostileReference*> StorageType;
+    // contiguous and kept in threat order by update(), only entries whose threat changed have to move
+    typedef std::vector<HostileReference*> StorageType;
 
     ThreatContainer() = default;
 
@@ -179,7 +181,9 @@ public:
 private:
     void remove(HostileReference* hostileRef)
     {
-        iThreatList.remove(hostileRef);
+        StorageType::iterator itr = std::find(iThreatList.begin(), iThreatList.end(), hostileRef);
+        if (itr != iThreatList.end())
+            iThreatList.erase(itr);
     }
 
     void addReference(HostileReference* hostileRef)
@@ -225,8 +229,8 @@ public:
     [[nodiscard]] bool isThreatListEmpty() const { return iThreatContainer.empty(); }
     [[nodiscard]] bool areThreatListsEmpty() const { return iThreatContainer.empty() && iThreatOfflineContainer.empty(); }
 
-    Acore::IteratorPair<std::list<ThreatReference*>::const_iterator> GetSortedThreatList() const { auto& list = iThreatContainer.GetThreatList(); return { list.cbegin(), list.cend() }; }
-    Acore::IteratorPair<std::list<ThreatReference*>::const_iterator> GetUnsortedThreatList() const { return GetSortedThreatList(); }
+    Acore::IteratorPair<ThreatContainer::StorageType::const_iterator> GetSortedThreatList() const { auto& list = iThreatContainer.GetThreatList(); return { list.cbegin(), list.cend() }; }
+    Acore::IteratorPair<ThreatContainer::StorageType::const_iterator> GetUnsortedThreatList() const { return GetSortedThreatList(); }
 
     void processThreatEvent(ThreatRefStatusChangeEvent* threatRefStatusChangeEvent);
 
@@ -259,8 +263,10 @@ public:
         if (threatList.empty())
             return;
 
-        for (auto& ref : threatList)
+        // indexed loop, threat changes may append new references (pet owners) to the list
+        for (std::size_t i = 0; i < threatList.size(); ++i)
         {
+            HostileReference* ref = threatList[i];
             if (predicate(ref->getTarget()))
             {
                 ref->SetThreat(0);
@@ -28,6 +28,8 @@
 #include "Spell.h"
 #include "SpellAuras.h"
 #include "SpellMgr.h"
+#include "WorldDatabaseSnapshot.h"
+#include <algorithm>
 
 // Checks if object meets the condition
 // Can have CONDITION_SOURCE_TYPE_NONE && !mReferenceId if called from a special event (ie: eventAI)
@@ -61,26 +63,20 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     }
     case CONDITION_ITEM:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                // don't allow 0 items (it's checked during table load)
-                ASSERT(ConditionValue2);
-                bool checkBank = !!ConditionValue3;
-                condMeets = player->HasItemCount(ConditionValue1, ConditionValue2, checkBank);
-            }
+            // don't allow 0 items (it's checked during table load)
+            ASSERT(ConditionValue2);
+            bool checkBank = !!ConditionValue3;
+            condMeets = player->HasItemCount(ConditionValue1, ConditionValue2, checkBank);
         }
         break;
     }
     case CONDITION_ITEM_EQUIPPED:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->HasItemOrGemWithIdEquipped(ConditionValue1, 1);
-            }
+            condMeets = player->HasItemOrGemWithIdEquipped(ConditionValue1, 1);
         }
         break;
     }
@@ -89,39 +85,30 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
         break;
     case CONDITION_REPUTATION_RANK:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
+            if (FactionEntry const* faction = sFactionStore.LookupEntry(ConditionValue1))
             {
-                if (FactionEntry const* faction = sFactionStore.LookupEntry(ConditionValue1))
-                {
-                    condMeets = (ConditionValue2 & (1 << player->GetReputationMgr().GetRank(faction)));
-                }
+                condMeets = (ConditionValue2 & (1 << player->GetReputationMgr().GetRank(faction)));
             }
         }
         break;
     }
     case CONDITION_ACHIEVEMENT:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->HasAchieved(ConditionValue1);
-            }
+            condMeets = player->HasAchieved(ConditionValue1);
         }
         break;
     }
     case CONDITION_TEAM:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                // Xinef: DB Data compatibility...
-                uint32 teamOld = player->GetTeamId() == TEAM_ALLIANCE ? ALLIANCE : HORDE;
-                condMeets = teamOld == ConditionValue1;
-            }
+            // Xinef: DB Data compatibility...
+            uint32 teamOld = player->GetTeamId() == TEAM_ALLIANCE ? ALLIANCE : HORDE;
+            condMeets = teamOld == ConditionValue1;
         }
         break;
     }
@@ -139,83 +126,62 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     }
     case CONDITION_GENDER:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->getGender() == ConditionValue1;
-            }
+            condMeets = player->getGender() == ConditionValue1;
         }
         break;
     }
     case CONDITION_SKILL:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->HasSkill(ConditionValue1) && player->GetBaseSkillValue(ConditionValue1) >= ConditionValue2;
-            }
+            condMeets = player->HasSkill(ConditionValue1) && player->GetBaseSkillValue(ConditionValue1) >= ConditionValue2;
         }
         break;
     }
     case CONDITION_QUESTREWARDED:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->GetQuestRewardStatus(ConditionValue1);
-            }
+            condMeets = player->GetQuestRewardStatus(ConditionValue1);
         }
         break;
     }
     case CONDITION_QUESTTAKEN:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                QuestStatus status = player->GetQuestStatus(ConditionValue1);
-                condMeets = (status == QUEST_STATUS_INCOMPLETE);
-            }
+            QuestStatus status = player->GetQuestStatus(ConditionValue1);
+            condMeets = (status == QUEST_STATUS_INCOMPLETE);
         }
         break;
     }
     case CONDITION_QUEST_COMPLETE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                QuestStatus status = player->GetQuestStatus(ConditionValue1);
-                condMeets = (status == QUEST_STATUS_COMPLETE && !player->GetQuestRewardStatus(ConditionValue1));
-            }
+            QuestStatus status = player->GetQuestStatus(ConditionValue1);
+            condMeets = (status == QUEST_STATUS_COMPLETE && !player->GetQuestRewardStatus(ConditionValue1));
         }
         break;
     }
     case CONDITION_QUEST_NONE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                QuestStatus status = player->GetQuestStatus(ConditionValue1);
-                condMeets = (status == QUEST_STATUS_NONE);
-            }
+            QuestStatus status = player->GetQuestStatus(ConditionValue1);
+            condMeets = (status == QUEST_STATUS_NONE);
         }
         break;
     }
     case CONDITION_QUEST_SATISFY_EXCLUSIVE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                // Xinef: cannot be null, checked at loading
-                const Quest* quest = sObjectMgr->GetQuestTemplate(ConditionValue1);
-                condMeets = !player->IsQuestRewarded(ConditionValue1) && player->SatisfyQuestExclusiveGroup(quest, false);
-            }
+            // Xinef: cannot be null, checked at loading
+            const Quest* quest = sObjectMgr->GetQuestTemplate(ConditionValue1);
+            condMeets = !player->IsQuestRewarded(ConditionValue1) && player->SatisfyQuestExclusiveGroup(quest, false);
         }
         break;
     }
@@ -256,12 +222,9 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
         break;
     case CONDITION_SPELL:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->HasSpell(ConditionValue1);
-            }
+            condMeets = player->HasSpell(ConditionValue1);
         }
         break;
     }
@@ -273,12 +236,9 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     }
     case CONDITION_DRUNKENSTATE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = (uint32)Player::GetDrunkenstateByValue(player->GetDrunkValue()) >= ConditionValue1;
-            }
+            condMeets = (uint32)Player::GetDrunkenstateByValue(player->GetDrunkValue()) >= ConditionValue1;
         }
         break;
     }
@@ -418,12 +378,9 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     }
     case CONDITION_TITLE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->HasTitle(ConditionValue1);
-            }
+            condMeets = player->HasTitle(ConditionValue1);
         }
         break;
     }
@@ -459,51 +416,42 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     }
     case CONDITION_QUESTSTATE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
+            uint32 queststateConditionValue1 = player->GetQuestStatus(ConditionValue1);
+            if (((ConditionValue2 & (1 << QUEST_STATUS_NONE)) && (queststateConditionValue1 == QUEST_STATUS_NONE)) ||
+                ((ConditionValue2 & (1 << QUEST_STATUS_COMPLETE)) && (queststateConditionValue1 == QUEST_STATUS_COMPLETE)) ||
+                ((ConditionValue2 & (1 << QUEST_STATUS_INCOMPLETE)) && (queststateConditionValue1 == QUEST_STATUS_INCOMPLETE)) ||
+                ((ConditionValue2 & (1 << QUEST_STATUS_FAILED)) && (queststateConditionValue1 == QUEST_STATUS_FAILED)) ||
+                ((ConditionValue2 & (1 << QUEST_STATUS_REWARDED)) && player->GetQuestRewardStatus(ConditionValue1)))
             {
-                uint32 queststateConditionValue1 = player->GetQuestStatus(ConditionValue1);
-                if (((ConditionValue2 & (1 << QUEST_STATUS_NONE)) && (queststateConditionValue1 == QUEST_STATUS_NONE)) ||
-                    ((ConditionValue2 & (1 << QUEST_STATUS_COMPLETE)) && (queststateConditionValue1 == QUEST_STATUS_COMPLETE)) ||
-                    ((ConditionValue2 & (1 << QUEST_STATUS_INCOMPLETE)) && (queststateConditionValue1 == QUEST_STATUS_INCOMPLETE)) ||
-                    ((ConditionValue2 & (1 << QUEST_STATUS_FAILED)) && (queststateConditionValue1 == QUEST_STATUS_FAILED)) ||
-                    ((ConditionValue2 & (1 << QUEST_STATUS_REWARDED)) && player->GetQuestRewardStatus(ConditionValue1)))
-                {
-                    condMeets = true;
-                }
+                condMeets = true;
             }
         }
         break;
     }
     case CONDITION_DAILY_QUEST_DONE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->IsDailyQuestDone(ConditionValue1);
-            }
+            condMeets = player->IsDailyQuestDone(ConditionValue1);
         }
         break;
     }
     case CONDITION_QUEST_OBJECTIVE_PROGRESS:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
+            Quest const* quest = ASSERT_NOTNULL(sObjectMgr->GetQuestTemplate(ConditionValue1));
+            uint16 log_slot = player->FindQuestSlot(quest->GetQuestId());
+            if (log_slot >= MAX_QUEST_LOG_SIZE)
             {
-                Quest const* quest = ASSERT_NOTNULL(sObjectMgr->GetQuestTemplate(ConditionValue1));
-                uint16 log_slot = player->FindQuestSlot(quest->GetQuestId());
-                if (log_slot >= MAX_QUEST_LOG_SIZE)
-                {
-                    break;
-                }
+                break;
+            }
 
-                if (player->GetQuestSlotCounter(log_slot, ConditionValue2) == ConditionValue3)
-                {
-                    condMeets = true;
-                }
+            if (player->GetQuestSlotCounter(log_slot, ConditionValue2) == ConditionValue3)
+            {
+                condMeets = true;
             }
         }
         break;
@@ -541,26 +489,20 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     }
     case CONDITION_PET_TYPE:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
+            if (Pet* pet = player->GetPet())
             {
-                if (Pet* pet = player->GetPet())
-                {
-                    condMeets = (((1 << pet->getPetType()) & ConditionValue1) != 0);
-                }
+                condMeets = (((1 << pet->getPetType()) & ConditionValue1) != 0);
             }
         }
         break;
     }
     case CONDITION_TAXI:
     {
-        if (Unit* unit = object->ToUnit())
+        if (Player* player = sourceInfo.GetConditionPlayer(ConditionTarget))
         {
-            if (Player* player = unit->GetCharmerOrOwnerPlayerOrPlayerItself())
-            {
-                condMeets = player->IsInFlight();
-            }
+            condMeets = player->IsInFlight();
         }
         break;
     }
@@ -585,6 +527,20 @@ bool Condition::Meets(ConditionSourceInfo& sourceInfo)
     return condMeets; // && script;
 }
 
+Player* ConditionSourceInfo::GetConditionPlayer(uint8 targetIndex)
+{
+    // spell target checks reuse the source info and replace the target, resolve again then
+    WorldObject* object = mConditionTargets[targetIndex];
+    if (_conditionPlayerSources[targetIndex] != object)
+    {
+        Unit* unit = object ? object->ToUnit() : nullptr;
+        _conditionPlayers[targetIndex] = unit ? unit->GetCharmerOrOwnerPlayerOrPlayerItself() : nullptr;
+        _conditionPlayerSources[targetIndex] = object;
+    }
+
+    return _conditionPlayers[targetIndex];
+}
+
 uint32 Condition::GetSearcherTypeMaskForCondition()
 {
     // build mask of types for which condition can return true
@@ -824,89 +780,108 @@ ConditionList ConditionMgr::GetConditionReferences(uint32 refId)
     return conditions;
 }
 
+void ConditionMgr::AddToConditionList(ConditionList& conditions, Condition* cond)
+{
+    // the rows are usually sorted by ElseGroup already, so this appends
+    auto itr = std::upper_bound(conditions.begin(), conditions.end(), cond->ElseGroup, [](uint32 elseGroup, Condition const* condition)
+    {
+        return elseGroup < condition->ElseGroup;
+    });
+
+    conditions.insert(itr, cond);
+}
+
 uint32 ConditionMgr::GetSearcherTypeMaskForConditionList(ConditionList const& conditions)
 {
     if (conditions.empty())
         return GRID_MAP_TYPE_MASK_ALL;
-    //     groupId, typeMask
-    std::map<uint32, uint32> ElseGroupStore;
+
+    // object will match condition when one of the ElseGroups is matching
+    // so, let's include the masks of all groups
+    uint32 mask = 0;
+    uint32 groupMask = GRID_MAP_TYPE_MASK_ALL;
     for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
     {
         // no point of having not loaded conditions in list
         ASSERT((*i)->isLoaded() && "ConditionMgr::GetSearcherTypeMaskForConditionList - not yet loaded condition found in list");
-        std::map<uint32, uint32>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-        // group not filled yet, fill with widest mask possible
-        if (itr == ElseGroupStore.end())
-            ElseGroupStore[(*i)->ElseGroup] = GRID_MAP_TYPE_MASK_ALL;
-        // no point of checking anymore, empty mask
-        else if (!(*itr).second)
-            continue;
 
-        if ((*i)->ReferenceId) // handle reference
+        // no point of checking anymore, empty mask
+        if (groupMask)
         {
-            ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-            ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
-            ElseGroupStore[(*i)->ElseGroup] &= GetSearcherTypeMaskForConditionList((*ref).second);
+            if ((*i)->ReferenceId) // handle reference
+            {
+                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
+                ASSERT(ref != ConditionReferenceStore.end() && "ConditionMgr::GetSearcherTypeMaskForConditionList - incorrect reference");
+                groupMask &= GetSearcherTypeMaskForConditionList((*ref).second);
+            }
+            else // handle normal condition
+            {
+                // object will match conditions in one ElseGroup only when it matches all of them
+                // so, let's find a smallest possible mask which satisfies all conditions
+                groupMask &= (*i)->GetSearcherTypeMaskForCondition();
+            }
         }
-        else // handle normal condition
+
+        // last condition of its ElseGroup
+        ConditionList::const_iterator next = std::next(i);
+        if (next == conditions.end() || (*next)->ElseGroup != (*i)->ElseGroup)
         {
-            // object will match conditions in one ElseGroupStore only when it matches all of them
-            // so, let's find a smallest possible mask which satisfies all conditions
-            ElseGroupStore[(*i)->ElseGroup] &= (*i)->GetSearcherTypeMaskForCondition();
+            mask |= groupMask;
+            groupMask = GRID_MAP_TYPE_MASK_ALL;
         }
     }
-    // object will match condition when one of the checks in ElseGroupStore is matching
-    // so, let's include all possible masks
-    uint32 mask = 0;
-    for (std::map<uint32, uint32>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i) mask |= i->second;
 
     return mask;
 }
 
 bool ConditionMgr::IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
 {
-    //     groupId, groupCheckPassed
-    std::map<uint32, bool> ElseGroupStore;
+    // the conditions of an ElseGroup are next to each other, the first group with all its conditions met
+    // decides the result. Groups without loaded conditions do not count.
+    bool groupLoaded = false;
+    bool groupMeets = true;
     for (ConditionList::const_iterator i = conditions.begin(); i != conditions.end(); ++i)
     {
-        LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", (*i)->ConditionType, (*i)->ConditionValue1);
         if ((*i)->isLoaded())
         {
-            //! Find ElseGroup in ElseGroupStore
-            std::map<uint32, bool>::const_iterator itr = ElseGroupStore.find((*i)->ElseGroup);
-            //! If not found, add an entry in the store and set to true (placeholder)
-            if (itr == ElseGroupStore.end())
-                ElseGroupStore[(*i)->ElseGroup] = true;
-            else if (!(*itr).second)
-                continue;
+            groupLoaded = true;
+            if (groupMeets && !IsObjectMeetToCondition(sourceInfo, *i))
+                groupMeets = false;
+        }
 
-            if ((*i)->ReferenceId) // handle reference
-            {
-                ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find((*i)->ReferenceId);
-                if (ref != ConditionReferenceStore.end())
-                {
-                    if (!IsObjectMeetToConditionList(sourceInfo, (*ref).second))
-                        ElseGroupStore[(*i)->ElseGroup] = false;
-                }
-                else
-                {
-                    LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", (*i)->ReferenceId);
-                }
-            }
-            else // handle normal condition
-            {
-                if (!(*i)->Meets(sourceInfo))
-                    ElseGroupStore[(*i)->ElseGroup] = false;
-            }
+        // last condition of its ElseGroup
+        ConditionList::const_iterator next = std::next(i);
+        if (next == conditions.end() || (*next)->ElseGroup != (*i)->ElseGroup)
+        {
+            if (groupLoaded && groupMeets)
+                return true;
+
+            groupLoaded = false;
+            groupMeets = true;
         }
     }
-    for (std::map<uint32, bool>::const_iterator i = ElseGroupStore.begin(); i != ElseGroupStore.end(); ++i)
-        if (i->second)
-            return true;
 
     return false;
 }
 
+bool ConditionMgr::IsObjectMeetToCondition(ConditionSourceInfo& sourceInfo, Condition* cond)
+{
+    LOG_DEBUG("condition", "ConditionMgr::IsPlayerMeetToConditionList condType: {} val1: {}", cond->ConditionType, cond->ConditionValue1);
+
+    if (!cond->ReferenceId) // handle normal condition
+        return cond->Meets(sourceInfo);
+
+    // handle reference
+    ConditionReferenceContainer::const_iterator ref = ConditionReferenceStore.find(cond->ReferenceId);
+    if (ref == ConditionReferenceStore.end())
+    {
+        LOG_DEBUG("condition", "IsPlayerMeetToConditionList: Reference template -{} not found", cond->ReferenceId);
+        return true;
+    }
+
+    return IsObjectMeetToConditionList(sourceInfo, (*ref).second);
+}
+
 bool ConditionMgr::IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions)
 {
     ConditionSourceInfo srcInfo = ConditionSourceInfo(object);
@@ -940,94 +915,69 @@ bool ConditionMgr::CanHaveSourceIdSet(ConditionSourceType sourceType) const
     return (sourceType == CONDITION_SOURCE_TYPE_SMART_EVENT);
 }
 
-ConditionList ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry)
+ConditionList const& ConditionMgr::GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const
 {
-    ConditionList spellCond;
     if (sourceType > CONDITION_SOURCE_TYPE_NONE && sourceType < CONDITION_SOURCE_TYPE_MAX)
     {
-        ConditionContainer::const_iterator itr = ConditionStore.find(sourceType);
-        if (itr != ConditionStore.end())
+        ConditionTypeContainer::const_iterator i = ConditionStore[sourceType].find(entry);
+        if (i != ConditionStore[sourceType].end())
         {
-            ConditionTypeContainer::const_iterator i = (*itr).second.find(entry);
-            if (i != (*itr).second.end())
-            {
-                spellCond = (*i).second;
-                LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
-            }
+            LOG_DEBUG("condition", "GetConditionsForNotGroupedEntry: found conditions for type {} and entry {}", uint32(sourceType), entry);
+            return (*i).second;
         }
     }
-    return spellCond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = SpellClickEventConditionStore.find(creatureId);
-    if (itr != SpellClickEventConditionStore.end())
+    CreatureSpellConditionContainer::const_iterator i = SpellClickEventConditionStore.find(MakeConditionKey(creatureId, spellId));
+    if (i != SpellClickEventConditionStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
+        LOG_DEBUG("condition", "GetConditionsForSpellClickEvent: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+        return (*i).second;
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId)
+ConditionList const& ConditionMgr::GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const
 {
-    ConditionList                                   cond;
-    CreatureSpellConditionContainer::const_iterator itr = VehicleSpellConditionStore.find(creatureId);
-    if (itr != VehicleSpellConditionStore.end())
+    CreatureSpellConditionContainer::const_iterator i = VehicleSpellConditionStore.find(MakeConditionKey(creatureId, spellId));
+    if (i != VehicleSpellConditionStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(spellId);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
-        }
+        LOG_DEBUG("condition", "GetConditionsForVehicleSpell: found conditions for Vehicle entry {} spell {}", creatureId, spellId);
+        return (*i).second;
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType)
+ConditionList const& ConditionMgr::GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const
 {
-    ConditionList                                cond;
-    SmartEventConditionContainer::const_iterator itr = SmartEventConditionStore.find(std::make_pair(entryOrGuid, sourceType));
-    if (itr != SmartEventConditionStore.end())
+    SmartEventConditionContainer::const_iterator i = SmartEventConditionStore.find({ entryOrGuid, sourceType, eventId + 1 });
+    if (i != SmartEventConditionStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(eventId + 1);
-        if (i != (*itr).second.end())
-        {
-            cond = (*i).second;
-            LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
-        }
+        LOG_DEBUG("condition", "GetConditionsForSmartEvent: found conditions for Smart Event entry or guid {} event_id {}", entryOrGuid, eventId);
+        return (*i).second;
     }
-    return cond;
+    return EmptyConditionList;
 }
 
-ConditionList ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId)
+ConditionList const& ConditionMgr::GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const
 {
-    ConditionList                               cond;
-    NpcVendorConditionContainer::const_iterator itr = NpcVendorConditionContainerStore.find(creatureId);
-    if (itr != NpcVendorConditionContainerStore.end())
+    NpcVendorConditionContainer::const_iterator i = NpcVendorConditionContainerStore.find(MakeConditionKey(creatureId, itemId));
+    if (i != NpcVendorConditionContainerStore.end())
     {
-        ConditionTypeContainer::const_iterator i = (*itr).second.find(itemId);
-        if (i != (*itr).second.end())
+        if (itemId)
         {
-            cond = (*i).second;
-            if (itemId)
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
-            }
-            else
-            {
-                LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
-            }
+            LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {} item {}", creatureId, itemId);
+        }
+        else
+        {
+            LOG_DEBUG("condition", "GetConditionsForNpcVendorEvent: found conditions for creature entry {}", creatureId);
         }
+        return (*i).second;
     }
-    return cond;
+    return EmptyConditionList;
 }
 
 void ConditionMgr::LoadConditions(bool isReload)
@@ -1062,7 +1012,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         sSpellMgr->UnloadSpellInfoImplicitTargetConditionLists();
     }
 
-    QueryResult result = WorldDatabase.Query("SELECT SourceTypeOrReferenceId, SourceGroup, SourceEntry, SourceId, ElseGroup, ConditionTypeOrReference, ConditionTarget, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT SourceTypeOrReferenceId, SourceGroup, SourceEntry, SourceId, ElseGroup, ConditionTypeOrReference, ConditionTarget, "
                                              " ConditionValue1, ConditionValue2, ConditionValue3, NegativeCondition, ErrorType, ErrorTextId, ScriptName FROM conditions");
 
     if (!result)
@@ -1137,12 +1087,7 @@ void ConditionMgr::LoadConditions(bool isReload)
         if (iSourceTypeOrReferenceId < 0) // it is a reference template
         {
             uint32 uRefId = std::abs(iSourceTypeOrReferenceId);
-            if (ConditionReferenceStore.find(uRefId) == ConditionReferenceStore.end()) // make sure we have a list for our conditions, based on reference id
-            {
-                ConditionList mCondList;
-                ConditionReferenceStore[uRefId] = mCondList;
-            }
-            ConditionReferenceStore[uRefId].push_back(cond); // add to reference storage
+            AddToConditionList(ConditionReferenceStore[uRefId], cond); // add to reference storage
             count++;
             continue;
         } // end of reference templates
@@ -1230,7 +1175,7 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_SPELL_CLICK_EVENT:
             {
-                SpellClickEventConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(SpellClickEventConditionStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
@@ -1240,23 +1185,22 @@ void ConditionMgr::LoadConditions(bool isReload)
                 break;
             case CONDITION_SOURCE_TYPE_VEHICLE_SPELL:
             {
-                VehicleSpellConditionStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(VehicleSpellConditionStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue; // do not add to m_AllocatedMemory to avoid double deleting
             }
             case CONDITION_SOURCE_TYPE_SMART_EVENT:
             {
-                //! TODO: PAIR_32 ?
-                std::pair<int32, uint32> key = std::make_pair(cond->SourceEntry, cond->SourceId);
-                SmartEventConditionStore[key][cond->SourceGroup].push_back(cond);
+                SmartEventConditionKey key = { cond->SourceEntry, cond->SourceId, cond->SourceGroup };
+                AddToConditionList(SmartEventConditionStore[key], cond);
                 valid = true;
                 ++count;
                 continue;
             }
             case CONDITION_SOURCE_TYPE_NPC_VENDOR:
             {
-                NpcVendorConditionContainerStore[cond->SourceGroup][cond->SourceEntry].push_back(cond);
+                AddToConditionList(NpcVendorConditionContainerStore[MakeConditionKey(cond->SourceGroup, cond->SourceEntry)], cond);
                 valid = true;
                 ++count;
                 continue;
@@ -1284,22 +1228,16 @@ void ConditionMgr::LoadConditions(bool isReload)
         }
 
         // handle not grouped conditions
-        // make sure we have a storage list for our SourceType
-        if (ConditionStore.find(cond->SourceType) == ConditionStore.end())
+        // references skip the SourceType validation
+        if (cond->SourceType >= CONDITION_SOURCE_TYPE_MAX)
         {
-            ConditionTypeContainer mTypeMap;
-            ConditionStore[cond->SourceType] = mTypeMap; // add new empty list for SourceType
-        }
-
-        // make sure we have a condition list for our SourceType's entry
-        if (ConditionStore[cond->SourceType].find(cond->SourceEntry) == ConditionStore[cond->SourceType].end())
-        {
-            ConditionList mCondList;
-            ConditionStore[cond->SourceType][cond->SourceEntry] = mCondList;
+            LOG_ERROR("sql.sql", "Invalid ConditionSourceType {} in `condition` table, ignoring.", uint32(cond->SourceType));
+            delete cond;
+            continue;
         }
 
         // add new Condition to storage based on Type/Entry
-        ConditionStore[cond->SourceType][cond->SourceEntry].push_back(cond);
+        AddToConditionList(ConditionStore[cond->SourceType][cond->SourceEntry], cond);
         ++count;
     } while (result->NextRow());
 
@@ -1332,7 +1270,7 @@ bool ConditionMgr::addToGossipMenus(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.TextID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1351,7 +1289,7 @@ bool ConditionMgr::addToGossipMenuItems(Condition* cond)
         {
             if ((*itr).second.MenuID == cond->SourceGroup && (*itr).second.OptionID == uint32(cond->SourceEntry))
             {
-                (*itr).second.Conditions.push_back(cond);
+                AddToConditionList((*itr).second.Conditions, cond);
                 return true;
             }
         }
@@ -1440,7 +1378,7 @@ bool ConditionMgr::addToSpellImplicitTargetConditions(Condition* cond)
                     delete sharedList;
             }
             if (sharedList)
-                sharedList->push_back(cond);
+                AddToConditionList(*sharedList, cond);
             break;
         }
     }
@@ -2462,76 +2400,19 @@ bool ConditionMgr::isConditionTypeValid(Condition* cond)
 
 void ConditionMgr::Clean()
 {
-    for (ConditionReferenceContainer::iterator itr = ConditionReferenceStore.begin(); itr != ConditionReferenceStore.end(); ++itr)
-    {
-        for (ConditionList::const_iterator it = itr->second.begin(); it != itr->second.end(); ++it) delete *it;
-        itr->second.clear();
-    }
+    DeleteConditionLists(ConditionReferenceStore);
 
-    ConditionReferenceStore.clear();
-
-    for (ConditionContainer::iterator itr = ConditionStore.begin(); itr != ConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    ConditionStore.clear();
-
-    for (CreatureSpellConditionContainer::iterator itr = VehicleSpellConditionStore.begin(); itr != VehicleSpellConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    VehicleSpellConditionStore.clear();
-
-    for (SmartEventConditionContainer::iterator itr = SmartEventConditionStore.begin(); itr != SmartEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    SmartEventConditionStore.clear();
-
-    for (CreatureSpellConditionContainer::iterator itr = SpellClickEventConditionStore.begin(); itr != SpellClickEventConditionStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
-
-    SpellClickEventConditionStore.clear();
-
-    for (NpcVendorConditionContainer::iterator itr = NpcVendorConditionContainerStore.begin(); itr != NpcVendorConditionContainerStore.end(); ++itr)
-    {
-        for (ConditionTypeContainer::iterator it = itr->second.begin(); it != itr->second.end(); ++it)
-        {
-            for (ConditionList::const_iterator i = it->second.begin(); i != it->second.end(); ++i) delete *i;
-            it->second.clear();
-        }
-        itr->second.clear();
-    }
+    for (ConditionTypeContainer& container : ConditionStore)
+        DeleteConditionLists(container);
 
-    NpcVendorConditionContainerStore.clear();
+    DeleteConditionLists(VehicleSpellConditionStore);
+    DeleteConditionLists(SmartEventConditionStore);
+    DeleteConditionLists(SpellClickEventConditionStore);
+    DeleteConditionLists(NpcVendorConditionContainerStore);
 
     // this is a BIG hack, feel free to fix it if you can figure out the ConditionMgr ;)
-    for (std::list<Condition*>::const_iterator itr = AllocatedMemoryStore.begin(); itr != AllocatedMemoryStore.end(); ++itr) delete *itr;
+    for (Condition* cond : AllocatedMemoryStore)
+        delete cond;
 
     AllocatedMemoryStore.clear();
 }
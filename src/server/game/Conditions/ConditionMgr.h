@@ -20,8 +20,9 @@
 
 #include "Define.h"
 #include "Errors.h"
-#include <list>
-#include <map>
+#include <array>
+#include <unordered_map>
+#include <vector>
 
 class Player;
 class Unit;
@@ -188,6 +189,14 @@ struct ConditionSourceInfo
         mConditionTargets[2] = target2;
         mLastFailedCondition = nullptr;
     }
+
+    // the player checked by player conditions: the target itself, or the player charming or owning it.
+    // Resolved once per target, lists of quest/item/reputation conditions do not repeat the owner lookup
+    Player* GetConditionPlayer(uint8 targetIndex);
+
+private:
+    WorldObject* _conditionPlayerSources[MAX_CONDITION_TARGETS] = { };
+    Player* _conditionPlayers[MAX_CONDITION_TARGETS] = { };
 };
 
 struct Condition
@@ -233,14 +242,33 @@ struct Condition
     uint32 GetMaxAvailableConditionTargets();
 };
 
-typedef std::list<Condition*> ConditionList;
-typedef std::map<uint32, ConditionList> ConditionTypeContainer;
-typedef std::map<ConditionSourceType, ConditionTypeContainer> ConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> CreatureSpellConditionContainer;
-typedef std::map<uint32, ConditionTypeContainer> NpcVendorConditionContainer;
-typedef std::map<std::pair<int32, uint32 /*SAI source_type*/>, ConditionTypeContainer> SmartEventConditionContainer;
+// conditions of the same ElseGroup are stored next to each other, see ConditionMgr::AddToConditionList
+typedef std::vector<Condition*> ConditionList;
+typedef std::unordered_map<uint32, ConditionList> ConditionTypeContainer;
+typedef std::array<ConditionTypeContainer, CONDITION_SOURCE_TYPE_MAX> ConditionContainer;
+typedef std::unordered_map<uint64 /*creatureId, spellId*/, ConditionList> CreatureSpellConditionContainer;
+typedef std::unordered_map<uint64 /*creatureId, itemId*/, ConditionList> NpcVendorConditionContainer;
+
+struct SmartEventConditionKey
+{
+    int32 EntryOrGuid;
+    uint32 SourceType; // SAI source_type
+    uint32 EventId;    // event_id + 1
+
+    bool operator==(SmartEventConditionKey const& right) const = default;
+};
+
+struct SmartEventConditionKeyHash
+{
+    std::size_t operator()(SmartEventConditionKey const& key) const
+    {
+        return std::hash<uint64>()((uint64(uint32(key.EntryOrGuid)) << 32 | key.EventId) ^ (uint64(key.SourceType) << 56));
+    }
+};
+
+typedef std::unordered_map<SmartEventConditionKey, ConditionList, SmartEventConditionKeyHash> SmartEventConditionContainer;
 
-typedef std::map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
+typedef std::unordered_map<uint32, ConditionList> ConditionReferenceContainer;//only used for references
 
 class ConditionMgr
 {
@@ -255,17 +283,20 @@ public:
     bool isConditionTypeValid(Condition* cond);
     ConditionList GetConditionReferences(uint32 refId);
 
+    /// Adds the condition behind the other conditions of its ElseGroup
+    static void AddToConditionList(ConditionList& conditions, Condition* cond);
+
     uint32 GetSearcherTypeMaskForConditionList(ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object, ConditionList const& conditions);
     bool IsObjectMeetToConditions(WorldObject* object1, WorldObject* object2, ConditionList const& conditions);
     bool IsObjectMeetToConditions(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
     [[nodiscard]] bool CanHaveSourceGroupSet(ConditionSourceType sourceType) const;
     [[nodiscard]] bool CanHaveSourceIdSet(ConditionSourceType sourceType) const;
-    ConditionList GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry);
-    ConditionList GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType);
-    ConditionList GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId);
-    ConditionList GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId);
+    ConditionList const& GetConditionsForNotGroupedEntry(ConditionSourceType sourceType, uint32 entry) const;
+    ConditionList const& GetConditionsForSpellClickEvent(uint32 creatureId, uint32 spellId) const;
+    ConditionList const& GetConditionsForSmartEvent(int32 entryOrGuid, uint32 eventId, uint32 sourceType) const;
+    ConditionList const& GetConditionsForVehicleSpell(uint32 creatureId, uint32 spellId) const;
+    ConditionList const& GetConditionsForNpcVendorEvent(uint32 creatureId, uint32 itemId) const;
 
 private:
     bool isSourceTypeValid(Condition* cond);
@@ -274,9 +305,22 @@ private:
     bool addToGossipMenuItems(Condition* cond);
     bool addToSpellImplicitTargetConditions(Condition* cond);
     bool IsObjectMeetToConditionList(ConditionSourceInfo& sourceInfo, ConditionList const& conditions);
+    bool IsObjectMeetToCondition(ConditionSourceInfo& sourceInfo, Condition* cond);
+
+    static uint64 MakeConditionKey(uint32 creatureId, uint32 id) { return uint64(creatureId) << 32 | id; }
+
+    template<class Container>
+    static void DeleteConditionLists(Container& container)
+    {
+        for (auto& [key, conditions] : container)
+            for (Condition* cond : conditions)
+                delete cond;
+
+        container.clear();
+    }
 
     void Clean(); // free up resources
-    std::list<Condition*> AllocatedMemoryStore; // some garbage collection :)
+    std::vector<Condition*> AllocatedMemoryStore; // some garbage collection :)
 
     ConditionContainer                ConditionStore;
     ConditionReferenceContainer       ConditionReferenceStore;
@@ -284,6 +328,8 @@ private:
     CreatureSpellConditionContainer   SpellClickEventConditionStore;
     NpcVendorConditionContainer       NpcVendorConditionContainerStore;
     SmartEventConditionContainer      SmartEventConditionStore;
+
+    static inline ConditionList const EmptyConditionList;
 };
 
 #define sConditionMgr ConditionMgr::instance()
@@ -200,6 +200,8 @@ DBCStorage <WorldMapOverlayEntry> sWorldMapOverlayStore(WorldMapOverlayEntryfmt)
 typedef std::list<std::string> StoreProblemList;
 
 uint32 DBCFileCount = 0;
+std::size_t DBCAllocatedSize = 0;
+std::size_t DBCMappedSize = 0;
 
 static bool LoadDBC_assert_print(uint32 fsize, uint32 rsize, const std::string& filename)
 {
@@ -218,6 +220,7 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     ++DBCFileCount;
     std::string dbcFilename = dbcPath + filename;
     bool existDBData = false;
+    auto startTime = std::chrono::steady_clock::now();
 
     if (storage.Load(dbcFilename.c_str()))
     {
@@ -242,6 +245,12 @@ inline void LoadDBC(uint32& availableDbcLocales, StoreProblemList& errors, DBCSt
     if (storage.GetNumRows())
         existDBData = true;
 
+    DBCAllocatedSize += storage.GetAllocatedSize();
+    DBCMappedSize += storage.GetMappedSize();
+    LOG_DEBUG("dbc", "Loaded {} ({} rows) in {} us, {} KB allocated, {} KB mapped", filename, storage.GetNumRows(),
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count(),
+        storage.GetAllocatedSize() / 1024, storage.GetMappedSize() / 1024);
+
     if (!existDBData)
     {
         // sort problematic dbc to (1) non compatible and (2) non-existed
@@ -267,6 +276,8 @@ void LoadDBCStores(const std::string& dataPath)
     StoreProblemList bad_dbc_files;
     uint32 availableDbcLocales = 0xFFFFFFFF;
 
+    DBCStorageBase::SetMemoryMapped(sWorld->getBoolConfig(CONFIG_DBC_MEMORY_MAPPED));
+
 #define LOAD_DBC(store, file, dbtable) LoadDBC(availableDbcLocales, bad_dbc_files, store, dbcPath, file, dbtable)
 
     LOAD_DBC(sAreaTableStore,                       "AreaTable.dbc",                        "areatable_dbc");
@@ -649,7 +660,8 @@ void LoadDBCStores(const std::string& dataPath)
         exit(1);
     }
 
-    LOG_INFO("server.loading", ">> Initialized {} Data Stores in {} ms", DBCFileCount, GetMSTimeDiffToNow(oldMSTime));
+    LOG_INFO("server.loading", ">> Initialized {} Data Stores in {} ms ({} KB allocated, {} KB mapped)", DBCFileCount, GetMSTimeDiffToNow(oldMSTime),
+        DBCAllocatedSize / 1024, DBCMappedSize / 1024);
     LOG_INFO("server.loading", " ");
 }
 
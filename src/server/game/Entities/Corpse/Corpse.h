@@ -55,6 +55,7 @@ public:
     void RemoveFromWorld() override;
 
     void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) override;
+    [[nodiscard]] bool HasViewerDependentValuesUpdate() const override;
 
     bool Create(ObjectGuid::LowType guidlow);
     bool Create(ObjectGuid::LowType guidlow, Player* owner);
@@ -678,6 +678,10 @@ void Creature::Update(uint32 diff)
             {
                 Respawn();
             }
+            else if (CanSleepUntilRespawn())
+            {
+                GetMap()->AddToRespawnQueue(this, m_respawnTime);
+            }
             break;
         }
         case DeathState::Corpse:
@@ -1949,6 +1953,10 @@ void Creature::setDeathState(DeathState s, bool despawn)
 {
     Unit::setDeathState(s, despawn);
 
+    // scripts may revive a dead creature waiting in the respawn queue without Respawn()
+    if (!CanBeRespawnDormant(s))
+        SetRespawnDormant(false);
+
     if (s == DeathState::JustDied)
     {
         _lastDamagedTime.reset();
@@ -2018,6 +2026,8 @@ void Creature::setDeathState(DeathState s, bool despawn)
 
 void Creature::Respawn(bool force)
 {
+    SetRespawnDormant(false);
+
     if (force)
     {
         if (IsAlive())
@@ -2030,7 +2040,7 @@ void Creature::Respawn(bool force)
         }
     }
 
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_RESPAWN, GetEntry());
 
     if (!sConditionMgr->IsObjectMeetToConditions(this, conditions) && !force)
     {
@@ -3734,6 +3744,15 @@ bool Creature::CanGeneratePickPocketLoot() const
 void Creature::SetRespawnTime(uint32 respawn)
 {
     m_respawnTime = respawn ? GameTime::GetGameTime().count() + respawn : 0;
+
+    // let the next update queue it again with the new time
+    SetRespawnDormant(false);
+}
+
+bool Creature::CanSleepUntilRespawn() const
+{
+    // while dead, Update() does nothing else than checking the respawn time for database spawns without update hooks
+    return m_spawnId && !GetOwnerGUID() && !sScriptMgr->HasCreatureUpdateHooks(this);
 }
 
 void Creature::SetCorpseRemoveTime(uint32 delay)
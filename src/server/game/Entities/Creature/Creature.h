@@ -280,6 +280,9 @@ public:
     [[nodiscard]] time_t GetRespawnTimeEx() const;
     void SetRespawnTime(uint32 respawn);
     void Respawn(bool force = false);
+    [[nodiscard]] bool CanSleepUntilRespawn() const;
+    /// Only dead creatures wait in the respawn queue of their map, any other state must be updated again
+    [[nodiscard]] static bool CanBeRespawnDormant(DeathState state) { return state == DeathState::Dead; }
     void SaveRespawnTime() override;
 
     [[nodiscard]] uint32 GetRespawnDelay() const { return m_respawnDelay; }
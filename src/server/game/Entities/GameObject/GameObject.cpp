@@ -903,6 +903,9 @@ void GameObject::Update(uint32 diff)
             }
     }
 
+    if (CanSleepUntilRespawn())
+        GetMap()->AddToRespawnQueue(this, m_respawnTime);
+
     sScriptMgr->OnGameObjectUpdate(this, diff);
 }
 
@@ -1300,6 +1303,7 @@ bool GameObject::IsInvisibleDueToDespawn() const
 void GameObject::SetRespawnTime(int32 respawn)
 {
     m_respawnTime = respawn > 0 ? GameTime::GetGameTime().count() + respawn : 0;
+    SetRespawnDormant(false);
     SetRespawnDelay(respawn);
     if (respawn && !m_spawnedByDefault)
     {
@@ -1318,9 +1322,26 @@ void GameObject::Respawn()
     {
         m_respawnTime = GameTime::GetGameTime().count();
         GetMap()->RemoveGORespawnTime(m_spawnId);
+        SetRespawnDormant(false);
     }
 }
 
+bool GameObject::CanSleepUntilRespawn() const
+{
+    // only despawned database spawns which wait for nothing but their respawn timer, like dead creatures
+    if (isSpawned() || m_lootState != GO_READY || !m_spawnedByDefault || !m_spawnId || GetOwnerGUID())
+        return false;
+
+    if (m_respawnTime <= GameTime::GetGameTime().count())
+        return false;
+
+    if (m_despawnDelay || !m_SkillupList.empty() || IsTransport())
+        return false;
+
+    // AI and update hooks keep running while the object is despawned
+    return GetAIName().empty() && !sScriptMgr->HasGameObjectUpdateHooks(this);
+}
+
 bool GameObject::ActivateToQuest(Player* target) const
 {
     if (target->HasQuestForGO(GetEntry()))
@@ -2604,6 +2625,9 @@ void GameObject::EnableCollision(bool enable)
         phaseMask = GetPhaseMask();
 
     m_model->enable(phaseMask);
+
+    if (Map* map = FindMap())
+        map->InvalidateCollisionCache(*m_model);
 }
 
 void GameObject::UpdateModel()
@@ -2727,6 +2751,22 @@ GameObject* GameObject::GetLinkedTrap()
     return ObjectAccessor::GetGameObject(*this, m_linkedTrap);
 }
 
+bool GameObject::HasViewerDependentValuesUpdate() const
+{
+    // dynamic flags of these types depend on the quests and loot rights of the viewer
+    switch (GetGoType())
+    {
+        case GAMEOBJECT_TYPE_QUESTGIVER:
+        case GAMEOBJECT_TYPE_CHEST:
+        case GAMEOBJECT_TYPE_GOOBER:
+        case GAMEOBJECT_TYPE_SPELL_FOCUS:
+        case GAMEOBJECT_TYPE_GENERIC:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
 {
     if (!target)
@@ -2735,96 +2775,89 @@ void GameObject::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* t
     bool forcedFlags = GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo()->chest.groupLootRules && HasLootRecipient();
     bool targetIsGM = target->IsGameMaster() && target->GetSession()->IsGMAccount();
 
-    ByteBuffer fieldBuffer;
-
-    UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
-
     uint32* flags = GameObjectUpdateFieldFlags;
     uint32 visibleFlag = UF_FLAG_PUBLIC;
     if (GetOwnerGUID() == target->GetGUID())
         visibleFlag |= UF_FLAG_OWNER;
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
+    UpdateMask updateMask;
+    BuildValuesUpdateMask(updateMask, updateType, _changesMask, m_uint32Values, flags, visibleFlag, _fieldNotifyFlags);
+
+    if (forcedFlags)
+        updateMask.SetBit(GAMEOBJECT_FLAGS);
+
+    *data << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(data);
+
+    updateMask.ForEachSetBit([&](uint32 index)
     {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-                (index == GAMEOBJECT_FLAGS && forcedFlags))
+        if (index == GAMEOBJECT_DYNAMIC)
         {
-            updateMask.SetBit(index);
-
-            if (index == GAMEOBJECT_DYNAMIC)
+            uint16 dynFlags = 0;
+            int16 pathProgress = -1;
+            switch (GetGoType())
             {
-                uint16 dynFlags = 0;
-                int16 pathProgress = -1;
-                switch (GetGoType())
-                {
-                    case GAMEOBJECT_TYPE_QUESTGIVER:
-                        if (ActivateToQuest(target))
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_CHEST:
-                    case GAMEOBJECT_TYPE_GOOBER:
-                        if (ActivateToQuest(target))
-                        {
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                            if (sWorld->getBoolConfig(CONFIG_OBJECT_SPARKLES))
-                                dynFlags |= GO_DYNFLAG_LO_SPARKLE;
-                        }
-                        else if (targetIsGM)
-                            dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
-                        break;
-                    case GAMEOBJECT_TYPE_SPELL_FOCUS:
-                    case GAMEOBJECT_TYPE_GENERIC:
-                        if (ActivateToQuest(target) && sWorld->getBoolConfig(CONFIG_OBJECT_SPARKLES))
+                case GAMEOBJECT_TYPE_QUESTGIVER:
+                    if (ActivateToQuest(target))
+                        dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                    break;
+                case GAMEOBJECT_TYPE_CHEST:
+                case GAMEOBJECT_TYPE_GOOBER:
+                    if (ActivateToQuest(target))
+                    {
+                        dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                        if (sWorld->getBoolConfig(CONFIG_OBJECT_SPARKLES))
                             dynFlags |= GO_DYNFLAG_LO_SPARKLE;
-                        break;
-                    case GAMEOBJECT_TYPE_TRANSPORT:
-                        if (const StaticTransport* t = ToStaticTransport())
-                            if (t->GetPauseTime())
+                    }
+                    else if (targetIsGM)
+                        dynFlags |= GO_DYNFLAG_LO_ACTIVATE;
+                    break;
+                case GAMEOBJECT_TYPE_SPELL_FOCUS:
+                case GAMEOBJECT_TYPE_GENERIC:
+                    if (ActivateToQuest(target) && sWorld->getBoolConfig(CONFIG_OBJECT_SPARKLES))
+                        dynFlags |= GO_DYNFLAG_LO_SPARKLE;
+                    break;
+                case GAMEOBJECT_TYPE_TRANSPORT:
+                    if (const StaticTransport* t = ToStaticTransport())
+                        if (t->GetPauseTime())
+                        {
+                            if (GetGoState() == GO_STATE_READY)
                             {
-                                if (GetGoState() == GO_STATE_READY)
-                                {
-                                    if (t->GetPathProgress() >= t->GetPauseTime()) // if not, send 100% progress
-                                        pathProgress = int16(float(t->GetPathProgress() - t->GetPauseTime()) / float(t->GetPeriod() - t->GetPauseTime()) * 65535.0f);
-                                }
-                                else
-                                {
-                                    if (t->GetPathProgress() <= t->GetPauseTime()) // if not, send 100% progress
-                                        pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPauseTime()) * 65535.0f);
-                                }
+                                if (t->GetPathProgress() >= t->GetPauseTime()) // if not, send 100% progress
+                                    pathProgress = int16(float(t->GetPathProgress() - t->GetPauseTime()) / float(t->GetPeriod() - t->GetPauseTime()) * 65535.0f);
                             }
-                        // else it's ignored
-                        break;
-                    case GAMEOBJECT_TYPE_MO_TRANSPORT:
-                        if (const MotionTransport* t = ToMotionTransport())
-                            pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPeriod()) * 65535.0f);
-                        break;
-                    default:
-                        break;
-                }
-
-                fieldBuffer << uint16(dynFlags);
-                fieldBuffer << int16(pathProgress);
+                            else
+                            {
+                                if (t->GetPathProgress() <= t->GetPauseTime()) // if not, send 100% progress
+                                    pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPauseTime()) * 65535.0f);
+                            }
+                        }
+                    // else it's ignored
+                    break;
+                case GAMEOBJECT_TYPE_MO_TRANSPORT:
+                    if (const MotionTransport* t = ToMotionTransport())
+                        pathProgress = int16(float(t->GetPathProgress()) / float(t->GetPeriod()) * 65535.0f);
+                    break;
+                default:
+                    break;
             }
-            else if (index == GAMEOBJECT_FLAGS)
-            {
-                uint32 goFlags = m_uint32Values[GAMEOBJECT_FLAGS];
-                if (GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo() && GetGOInfo()->chest.groupLootRules && !IsLootAllowedFor(target))
-                {
-                    goFlags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
-                }
 
-                fieldBuffer << goFlags;
-            }
-            else
-                fieldBuffer << m_uint32Values[index];                // other cases
+            *data << uint16(dynFlags);
+            *data << int16(pathProgress);
         }
-    }
+        else if (index == GAMEOBJECT_FLAGS)
+        {
+            uint32 goFlags = m_uint32Values[GAMEOBJECT_FLAGS];
+            if (GetGoType() == GAMEOBJECT_TYPE_CHEST && GetGOInfo() && GetGOInfo()->chest.groupLootRules && !IsLootAllowedFor(target))
+            {
+                goFlags |= GO_FLAG_LOCKED | GO_FLAG_NOT_SELECTABLE;
+            }
 
-    *data << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+            *data << goFlags;
+        }
+        else
+            *data << m_uint32Values[index];                // other cases
+    });
 }
 
 void GameObject::GetRespawnPosition(float& x, float& y, float& z, float* ori /* = nullptr*/) const
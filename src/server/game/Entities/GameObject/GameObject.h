@@ -124,6 +124,7 @@ public:
     ~GameObject() override;
 
     void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) override;
+    [[nodiscard]] bool HasViewerDependentValuesUpdate() const override;
 
     void AddToWorld() override;
     void RemoveFromWorld() override;
@@ -187,6 +188,7 @@ public:
     void SetRespawnTime(int32 respawn);
     void SetRespawnDelay(int32 respawn);
     void Respawn();
+    [[nodiscard]] bool CanSleepUntilRespawn() const;
     [[nodiscard]] bool isSpawned() const
     {
         return m_respawnDelayTime == 0 ||
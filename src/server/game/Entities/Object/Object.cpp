@@ -499,26 +499,18 @@ void Object::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* targe
     if (!target)
         return;
 
-    ByteBuffer fieldBuffer;
-    UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
-
     uint32* flags = nullptr;
     uint32 visibleFlag = GetUpdateFieldData(target, flags);
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-    {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)))
-        {
-            updateMask.SetBit(index);
-            fieldBuffer << m_uint32Values[index];
-        }
-    }
+    UpdateMask updateMask;
+    BuildValuesUpdateMask(updateMask, updateType, _changesMask, m_uint32Values, flags, visibleFlag, _fieldNotifyFlags);
 
     *data << uint8(updateMask.GetBlockCount());
     updateMask.AppendToPacket(data);
-    data->append(fieldBuffer);
+    updateMask.ForEachSetBit([&](uint32 index)
+    {
+        *data << m_uint32Values[index];
+    });
 }
 
 void Object::AddToObjectUpdateIfNeeded()
@@ -533,6 +525,7 @@ void Object::AddToObjectUpdateIfNeeded()
 void Object::ClearUpdateMask(bool remove)
 {
     _changesMask.Clear();
+    _sharedValuesUpdates.clear();
 
     if (m_objectUpdated)
     {
@@ -553,7 +546,33 @@ void Object::BuildFieldsUpdate(Player* player, UpdateDataMapType& data_map)
         iter = p.first;
     }
 
-    BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+    if (HasViewerDependentValuesUpdate())
+    {
+        BuildValuesUpdateBlockForPlayer(&iter->second, iter->first);
+        return;
+    }
+
+    // Viewers of the same visibility class receive the same bytes, build them once per update pass.
+    // The pass always ends with ClearUpdateMask(), which drops the shared blocks.
+    uint32* flags = nullptr;
+    uint32 visibleFlag = GetUpdateFieldData(player, flags);
+
+    auto shared = std::find_if(_sharedValuesUpdates.begin(), _sharedValuesUpdates.end(),
+        [visibleFlag](std::pair<uint32, ByteBuffer> const& block) { return block.first == visibleFlag; });
+
+    if (shared == _sharedValuesUpdates.end())
+    {
+        ByteBuffer buf(500);
+
+        buf << (uint8) UPDATETYPE_VALUES;
+        buf << GetPackGUID();
+
+        BuildValuesUpdate(UPDATETYPE_VALUES, &buf, player);
+
+        shared = _sharedValuesUpdates.emplace(_sharedValuesUpdates.end(), visibleFlag, std::move(buf));
+    }
+
+    iter->second.AddUpdateBlock(shared->second);
 }
 
 uint32 Object::GetUpdateFieldData(Player const* target, uint32*& flags) const
@@ -1048,7 +1067,7 @@ void MovementInfo::OutDebug()
 }
 
 WorldObject::WorldObject(bool isWorldObject) : WorldLocation(),
-    LastUsedScriptID(0), m_name(""), m_isActive(false), m_visibilityDistanceOverride(), m_isWorldObject(isWorldObject), m_zoneScript(nullptr),
+    LastUsedScriptID(0), m_name(""), m_isActive(false), m_isRespawnDormant(false), m_visibilityDistanceOverride(), m_isWorldObject(isWorldObject), m_zoneScript(nullptr),
     _zoneId(0), _areaId(0), _floorZ(INVALID_HEIGHT), _outdoors(false), _liquidData(), _updatePositionData(false), m_transport(nullptr),
     m_currMap(nullptr), m_InstanceId(0), m_phaseMask(PHASEMASK_NORMAL), m_useCombinedPhases(true), m_notifyflags(0), m_executed_notifies(0)
 {
@@ -1186,6 +1205,8 @@ void WorldObject::RemoveFromWorld()
 
     DestroyForNearbyPlayers();
 
+    m_isRespawnDormant = false;
+
     Object::RemoveFromWorld();
 }
 
@@ -1744,7 +1765,7 @@ bool WorldObject::CanSeeOrDetect(WorldObject const* obj, bool ignoreStealth, boo
                 return false;
             }
 
-            ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
+            ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_CREATURE_VISIBILITY, cObj->GetEntry());
             if (!sConditionMgr->IsObjectMeetToConditions((WorldObject*)this, (WorldObject*)obj, conditions))
             {
                 return false;
@@ -32,6 +32,7 @@
 #include "UpdateData.h"
 #include "UpdateMask.h"
 #include <memory>
+#include <memory_resource>
 #include <set>
 #include <sstream>
 #include <string>
@@ -93,8 +94,9 @@ class MotionTransport;
 
 struct PositionFullTerrainStatus;
 
-typedef std::unordered_map<Player*, UpdateData> UpdateDataMapType;
-typedef GuidUnorderedSet UpdatePlayerSet;
+// built once per map update, allocated from the tick arena of the map thread
+typedef std::pmr::unordered_map<Player*, UpdateData> UpdateDataMapType;
+typedef GuidPmrUnorderedSet UpdatePlayerSet;
 
 class Object
 {
@@ -228,6 +230,9 @@ protected:
     void BuildMovementUpdate(ByteBuffer* data, uint16 flags) const;
     virtual void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target);
 
+    // true if the values update depends on more than the visibility class of the viewer, it is then never shared
+    [[nodiscard]] virtual bool HasViewerDependentValuesUpdate() const { return false; }
+
     uint16 m_objectType;
 
     TypeID m_objectTypeId;
@@ -257,6 +262,9 @@ private:
 
     PackedGuid m_PackGUID;
 
+    // values update blocks built during the current update pass, by visibility flags of the viewers
+    std::vector<std::pair<uint32, ByteBuffer>> _sharedValuesUpdates;
+
     // for output helpfull error messages from asserts
     [[nodiscard]] bool PrintIndexError(uint32 index, bool set) const;
     Object(const Object&);                              // prevent generation copy constructor
@@ -564,6 +572,9 @@ public:
 
     [[nodiscard]] bool isActiveObject() const { return m_isActive; }
     void setActive(bool isActiveObject);
+    // dormant objects wait in the respawn queue of their map and are skipped by the grid updates
+    [[nodiscard]] bool IsRespawnDormant() const { return m_isRespawnDormant; }
+    void SetRespawnDormant(bool dormant) { m_isRespawnDormant = dormant; }
     [[nodiscard]] bool IsFarVisible() const { return m_isFarVisible; }
     [[nodiscard]] bool IsVisibilityOverridden() const { return m_visibilityDistanceOverride.has_value(); }
     void SetVisibilityDistanceOverride(VisibilityDistanceType type);
@@ -628,6 +639,7 @@ public:
 protected:
     std::string m_name;
     bool m_isActive;
+    bool m_isRespawnDormant;
     bool m_isFarVisible;
     Optional<float> m_visibilityDistanceOverride;
     const bool m_isWorldObject;
@@ -23,6 +23,7 @@
 #include <deque>
 #include <functional>
 #include <list>
+#include <memory_resource>
 #include <set>
 #include <unordered_set>
 #include <vector>
@@ -256,6 +257,10 @@ typedef std::deque<ObjectGuid> GuidDeque;
 typedef std::vector<ObjectGuid> GuidVector;
 typedef std::unordered_set<ObjectGuid> GuidUnorderedSet;
 
+// for containers allocated from Acore::GetTickArenaResource()
+typedef std::pmr::vector<ObjectGuid> GuidPmrVector;
+typedef std::pmr::unordered_set<ObjectGuid> GuidPmrUnorderedSet;
+
 // minimum buffer size for packed guid is 9 bytes
 #define PACKED_GUID_MIN_BUFFER_SIZE 9
 
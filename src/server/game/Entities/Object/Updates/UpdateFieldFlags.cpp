@@ -16,6 +16,8 @@
  */
 
 #include "UpdateFieldFlags.h"
+#include "UpdateData.h"
+#include "UpdateMask.h"
 
 uint32 ItemUpdateFieldFlags[CONTAINER_END] =
 {
@@ -1566,3 +1568,84 @@ uint32 CorpseUpdateFieldFlags[CORPSE_END] =
     UF_FLAG_DYNAMIC,                                        // CORPSE_FIELD_DYNAMIC_FLAGS
     UF_FLAG_NONE,                                           // CORPSE_FIELD_PAD
 };
+
+namespace
+{
+    // UF_FLAG_DYNAMIC is the highest flag
+    constexpr uint32 UPDATE_FIELD_FLAG_BITS = 9;
+
+    // For every flag bit, the mask of the fields of a table carrying it
+    struct UpdateFieldFlagMasks
+    {
+        UpdateFieldFlagMasks(uint32 const* flags, uint32 count) : Flags(flags)
+        {
+            for (uint32 bit = 0; bit < UPDATE_FIELD_FLAG_BITS; ++bit)
+            {
+                Masks[bit].SetCount(count);
+                for (uint32 index = 0; index < count; ++index)
+                    if (flags[index] & (1 << bit))
+                        Masks[bit].SetBit(index);
+            }
+        }
+
+        uint32 const* Flags;
+        std::array<UpdateMask, UPDATE_FIELD_FLAG_BITS> Masks;
+    };
+
+    UpdateFieldFlagMasks const& GetUpdateFieldFlagMasks(uint32 const* flags)
+    {
+        static std::array<UpdateFieldFlagMasks, 5> const tables =
+        { {
+            { ItemUpdateFieldFlags, CONTAINER_END },
+            { UnitUpdateFieldFlags, PLAYER_END },
+            { GameObjectUpdateFieldFlags, GAMEOBJECT_END },
+            { DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END },
+            { CorpseUpdateFieldFlags, CORPSE_END }
+        } };
+
+        for (UpdateFieldFlagMasks const& table : tables)
+            if (table.Flags == flags)
+                return table;
+
+        ABORT("Unknown update field flags table");
+    }
+
+    void BuildFlagBlocks(UpdateFieldFlagMasks const& table, uint32 fieldFlags, uint32 blockCount, UpdateMask::ClientUpdateMaskType* blocks)
+    {
+        for (uint32 bit = 0; bit < UPDATE_FIELD_FLAG_BITS; ++bit)
+        {
+            if (!(fieldFlags & (1 << bit)))
+                continue;
+
+            for (uint32 i = 0; i < blockCount; ++i)
+                blocks[i] |= table.Masks[bit].GetBlock(i);
+        }
+    }
+}
+
+void BuildValuesUpdateMask(UpdateMask& updateMask, uint8 updateType, UpdateMask const& changesMask, uint32 const* values, uint32 const* flags, uint32 visibleFlag, uint32 notifyFlags)
+{
+    UpdateFieldFlagMasks const& table = GetUpdateFieldFlagMasks(flags);
+
+    uint32 const count = changesMask.GetCount();
+    updateMask.SetCount(count);
+
+    if (updateType == UPDATETYPE_VALUES)
+        updateMask |= changesMask;
+    else
+        updateMask.SetNonZeroBits(values);
+
+    std::array<UpdateMask::ClientUpdateMaskType, UpdateMask::MAX_BLOCK_COUNT> visible{};
+    std::array<UpdateMask::ClientUpdateMaskType, UpdateMask::MAX_BLOCK_COUNT> notify{};
+
+    uint32 const blockCount = updateMask.GetBlockCount();
+    BuildFlagBlocks(table, visibleFlag, blockCount, visible.data());
+    BuildFlagBlocks(table, notifyFlags, blockCount, notify.data());
+
+    for (uint32 i = 0; i < blockCount; ++i)
+        updateMask.SetBlock(i, (updateMask.GetBlock(i) & visible[i]) | notify[i]);
+
+    // the tables can be longer than the object (items share theirs with containers, creatures with players)
+    if (uint32 tailBits = count % UpdateMask::CLIENT_UPDATE_MASK_BITS)
+        updateMask.SetBlock(blockCount - 1, updateMask.GetBlock(blockCount - 1) & ((UpdateMask::ClientUpdateMaskType(1) << tailBits) - 1));
+}
@@ -21,6 +21,8 @@
 #include "Define.h"
 #include "UpdateFields.h"
 
+class UpdateMask;
+
 enum UpdatefieldFlags
 {
     UF_FLAG_NONE         = 0x000,
@@ -41,4 +43,16 @@ extern uint32 GameObjectUpdateFieldFlags[GAMEOBJECT_END];
 extern uint32 DynamicObjectUpdateFieldFlags[DYNAMICOBJECT_END];
 extern uint32 CorpseUpdateFieldFlags[CORPSE_END];
 
+/**
+ * @brief Builds the mask of the fields written by a values update block.
+ *
+ * A field is sent if it is visible for visibleFlag and either changed (UPDATETYPE_VALUES, taken from changesMask)
+ * or non zero (create blocks), or if it carries one of notifyFlags. The visibility tests are done a whole mask block
+ * at a time against per flag masks built once from the tables above.
+ *
+ * @param updateMask Receives the result, sized like changesMask
+ * @param flags One of the field flag tables above
+ */
+void BuildValuesUpdateMask(UpdateMask& updateMask, uint8 updateType, UpdateMask const& changesMask, uint32 const* values, uint32 const* flags, uint32 visibleFlag, uint32 notifyFlags);
+
 #endif // _UPDATEFIELDFLAGS_H
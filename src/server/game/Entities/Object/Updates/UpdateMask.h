@@ -20,7 +20,17 @@
 
 #include "ByteBuffer.h"
 #include "Errors.h"
+#include "UpdateFields.h"
+#include <algorithm>
+#include <array>
+#include <bit>
 
+/**
+ * @brief Bitset of update fields, stored in the blocks the client reads.
+ *
+ * The storage is sized for the largest object (players) and kept inline, so temporary masks built
+ * for every values update do not allocate.
+ */
 class UpdateMask
 {
 public:
@@ -32,31 +42,38 @@ public:
         CLIENT_UPDATE_MASK_BITS = sizeof(ClientUpdateMaskType) * 8,
     };
 
-    UpdateMask()  = default;
+    static constexpr uint32 MAX_BLOCK_COUNT = (uint32(PLAYER_END) + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
+
+    UpdateMask() = default;
+    explicit UpdateMask(uint32 valuesCount) { SetCount(valuesCount); }
+
+    void SetBit(uint32 index) { _blocks[index / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS); }
+    void UnsetBit(uint32 index) { _blocks[index / CLIENT_UPDATE_MASK_BITS] &= ~(ClientUpdateMaskType(1) << (index % CLIENT_UPDATE_MASK_BITS)); }
+    [[nodiscard]] bool GetBit(uint32 index) const { return (_blocks[index / CLIENT_UPDATE_MASK_BITS] >> (index % CLIENT_UPDATE_MASK_BITS)) & 1; }
+
+    [[nodiscard]] ClientUpdateMaskType GetBlock(uint32 block) const { return _blocks[block]; }
+    void SetBlock(uint32 block, ClientUpdateMaskType bits) { _blocks[block] = bits; }
 
-    UpdateMask(UpdateMask const& right)
+    /// Sets the bit of every non zero value, values must hold GetCount() entries
+    void SetNonZeroBits(uint32 const* values)
     {
-        SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * 32);
+        for (uint32 i = 0; i < _fieldCount; ++i)
+            _blocks[i / CLIENT_UPDATE_MASK_BITS] |= ClientUpdateMaskType(values[i] != 0) << (i % CLIENT_UPDATE_MASK_BITS);
     }
 
-    ~UpdateMask() { delete[] _bits; }
-
-    void SetBit(uint32 index) { _bits[index] = 1; }
-    void UnsetBit(uint32 index) { _bits[index] = 0; }
-    [[nodiscard]] bool GetBit(uint32 index) const { return _bits[index] != 0; }
+    /// Calls callback with the index of every set bit, in ascending order
+    template<typename Callback>
+    void ForEachSetBit(Callback&& callback) const
+    {
+        for (uint32 i = 0; i < _blockCount; ++i)
+            for (ClientUpdateMaskType bits = _blocks[i]; bits; bits &= bits - 1)
+                callback(i * CLIENT_UPDATE_MASK_BITS + uint32(std::countr_zero(bits)));
+    }
 
-    void AppendToPacket(ByteBuffer* data)
+    void AppendToPacket(ByteBuffer* data) const
     {
-        for (uint32 i = 0; i < GetBlockCount(); ++i)
-        {
-            ClientUpdateMaskType maskPart = 0;
-            for (uint32 j = 0; j < CLIENT_UPDATE_MASK_BITS; ++j)
-                if (_bits[CLIENT_UPDATE_MASK_BITS * i + j])
-                    maskPart |= 1 << j;
-
-            *data << maskPart;
-        }
+        for (uint32 i = 0; i < _blockCount; ++i)
+            *data << _blocks[i];
     }
 
     [[nodiscard]] uint32 GetBlockCount() const { return _blockCount; }
@@ -64,36 +81,23 @@ public:
 
     void SetCount(uint32 valuesCount)
     {
-        delete[] _bits;
+        ASSERT(valuesCount <= MAX_BLOCK_COUNT * CLIENT_UPDATE_MASK_BITS);
 
         _fieldCount = valuesCount;
         _blockCount = (valuesCount + CLIENT_UPDATE_MASK_BITS - 1) / CLIENT_UPDATE_MASK_BITS;
-
-        _bits = new uint8[_blockCount * CLIENT_UPDATE_MASK_BITS];
-        memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
+        _blocks.fill(0);
     }
 
     void Clear()
     {
-        if (_bits)
-            memset(_bits, 0, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
-    }
-
-    UpdateMask& operator=(UpdateMask const& right)
-    {
-        if (this == &right)
-            return *this;
-
-        SetCount(right.GetCount());
-        memcpy(_bits, right._bits, sizeof(uint8) * _blockCount * CLIENT_UPDATE_MASK_BITS);
-        return *this;
+        std::fill_n(_blocks.begin(), _blockCount, 0);
     }
 
     UpdateMask& operator&=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] &= right._bits[i];
+        for (uint32 i = 0; i < _blockCount; ++i)
+            _blocks[i] &= right._blocks[i];
 
         return *this;
     }
@@ -101,13 +105,13 @@ public:
     UpdateMask& operator|=(UpdateMask const& right)
     {
         ASSERT(right.GetCount() <= GetCount());
-        for (uint32 i = 0; i < _fieldCount; ++i)
-            _bits[i] |= right._bits[i];
+        for (uint32 i = 0; i < _blockCount; ++i)
+            _blocks[i] |= right._blocks[i];
 
         return *this;
     }
 
-    UpdateMask operator|(UpdateMask const& right)
+    UpdateMask operator|(UpdateMask const& right) const
     {
         UpdateMask ret(*this);
         ret |= right;
@@ -117,7 +121,7 @@ public:
 private:
     uint32 _fieldCount{0};
     uint32 _blockCount{0};
-    uint8* _bits{nullptr};
+    std::array<ClientUpdateMaskType, MAX_BLOCK_COUNT> _blocks{};
 };
 
 #endif
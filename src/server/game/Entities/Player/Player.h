@@ -2857,6 +2857,7 @@ public:
     GroupReference m_originalGroup;
     Group* m_groupInvite;
     uint32 m_groupUpdateMask;
+    TimeTrackerSmall m_groupUpdateTimer;
     uint64 m_auraRaidUpdateMask;
     bool m_bPassOnGroupLoot;
 
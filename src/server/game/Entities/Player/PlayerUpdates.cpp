@@ -383,6 +383,9 @@ void Player::Update(uint32 p_time)
     }
 
     // group update
+    if (!m_groupUpdateTimer.Passed())
+        m_groupUpdateTimer.Update(p_time);
+
     SendUpdateToOutOfRangeGroupMembers();
 
     Pet* pet = GetPet();
@@ -1767,7 +1770,7 @@ void Player::UpdateForQuestWorldObjects()
                 {
                     //! This code doesn't look right, but it was logically converted to condition system to do the exact
                     //! same thing it did before. It definitely needs to be overlooked for intended functionality.
-                    ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
+                    ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(obj->GetEntry(), _itr->second.spellId);
                     bool buildUpdateBlock = false;
                     for (ConditionList::const_iterator jtr = conds.begin(); jtr != conds.end() && !buildUpdateBlock; ++jtr)
                         if ((*jtr)->ConditionType == CONDITION_QUESTREWARDED || (*jtr)->ConditionType == CONDITION_QUESTTAKEN)
@@ -20,6 +20,7 @@
 #include "CellImpl.h"
 #include "Common.h"
 #include "DBCStores.h"
+#include "DynamicVisibility.h"
 #include "GameObjectAI.h"
 #include "GameTime.h"
 #include "MapMgr.h"
@@ -210,6 +211,8 @@ void MotionTransport::Update(uint32 diff)
 
     // Set position
     _positionChangeTimer.Update(diff);
+    if (!_passengerVisibilityTimer.Passed())
+        _passengerVisibilityTimer.Update(diff);
     if (_positionChangeTimer.Passed())
     {
         _positionChangeTimer.Reset(positionUpdateDelay);
@@ -253,12 +256,17 @@ void MotionTransport::UpdatePosition(float x, float y, float z, float o)
     Relocate(x, y, z, o);
     UpdateModelPosition();
 
-    UpdatePassengerPositions(_passengers);
+    // passengers staying in their cell skip the immediate visibility update, refresh it for all of them periodically
+    bool const updateVisibility = _passengerVisibilityTimer.Passed();
+    if (updateVisibility)
+        _passengerVisibilityTimer.Reset(DynamicVisibilityMgr::GetVisibilityNotifyDelay(GetMap()->GetEntry()->map_type));
+
+    UpdatePassengerPositions(_passengers, updateVisibility);
 
     if (_staticPassengers.empty())
         LoadStaticPassengers();
     else
-        UpdatePassengerPositions(_staticPassengers);
+        UpdatePassengerPositions(_staticPassengers, updateVisibility);
 }
 
 void MotionTransport::AddPassenger(WorldObject* passenger, bool withAll)
@@ -602,13 +610,31 @@ void MotionTransport::DelayedTeleportTransport()
     LoadStaticPassengers();
 }
 
-void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
+void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers, bool updateVisibility)
 {
+    // same transform as TransportBase::CalculatePassengerPosition, with the rotation computed once for all passengers
+    float const transX = GetPositionX();
+    float const transY = GetPositionY();
+    float const transZ = GetPositionZ();
+    float const transO = GetOrientation();
+    float const cosO = std::cos(transO);
+    float const sinO = std::sin(transO);
+
+    auto calculatePosition = [&](float& x, float& y, float& z, float& o)
+    {
+        float const inx = x, iny = y;
+        x = transX + inx * cosO - iny * sinO;
+        y = transY + iny * cosO + inx * sinO;
+        z = transZ + z;
+        o = NormalizeOrientation(transO + o);
+    };
+
+    Map* map = GetMap();
     for (PassengerSet::iterator itr = passengers.begin(); itr != passengers.end(); ++itr)
     {
         WorldObject* passenger = *itr;
         // transport teleported but passenger not yet (can happen for players)
-        if (passenger->GetMap() != GetMap())
+        if (passenger->GetMap() != map)
             continue;
 
         // if passenger is on vehicle we have to assume the vehicle is also on transport and its the vehicle that will be updating its passengers
@@ -619,7 +645,7 @@ void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
         // Do not use Unit::UpdatePosition here, we don't want to remove auras as if regular movement occurred
         float x, y, z, o;
         passenger->m_movementInfo.transport.pos.GetPosition(x, y, z, o);
-        CalculatePassengerPosition(x, y, z, &o);
+        calculatePosition(x, y, z, o);
 
         // check if position is valid
         if (!Acore::IsValidMapCoord(x, y, z))
@@ -630,22 +656,20 @@ void MotionTransport::UpdatePassengerPositions(PassengerSet& passengers)
             case TYPEID_UNIT:
                 {
                     Creature* creature = passenger->ToCreature();
-                    GetMap()->CreatureRelocation(creature, x, y, z, o);
+                    map->TransportPassengerRelocation(creature, x, y, z, o, updateVisibility);
 
                     creature->GetTransportHomePosition(x, y, z, o);
-                    CalculatePassengerPosition(x, y, z, &o);
+                    calculatePosition(x, y, z, o);
                     creature->SetHomePosition(x, y, z, o);
                 }
                 break;
             case TYPEID_PLAYER:
                 if (passenger->IsInWorld())
-                    GetMap()->PlayerRelocation(passenger->ToPlayer(), x, y, z, o);
+                    map->TransportPassengerRelocation(passenger, x, y, z, o, updateVisibility);
                 break;
             case TYPEID_GAMEOBJECT:
-                GetMap()->GameObjectRelocation(passenger->ToGameObject(), x, y, z, o);
-                break;
             case TYPEID_DYNAMICOBJECT:
-                GetMap()->DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o);
+                map->TransportPassengerRelocation(passenger, x, y, z, o, updateVisibility);
                 break;
             default:
                 break;
@@ -84,7 +84,7 @@ private:
     float CalculateSegmentPos(float perc);
     bool TeleportTransport(uint32 newMapid, float x, float y, float z, float o);
     void DelayedTeleportTransport();
-    void UpdatePassengerPositions(PassengerSet& passengers);
+    void UpdatePassengerPositions(PassengerSet& passengers, bool updateVisibility);
     void DoEventIfAny(KeyFrame const& node, bool departure);
 
     //! Helpers to know if stop frame was reached
@@ -95,6 +95,7 @@ private:
     KeyFrameVec::const_iterator _currentFrame;
     KeyFrameVec::const_iterator _nextFrame;
     TimeTrackerSmall _positionChangeTimer;
+    TimeTrackerSmall _passengerVisibilityTimer;
     bool _isMoving;
     bool _pendingStop;
 
@@ -59,6 +59,7 @@
 #include "StringConvert.h"
 #include "TargetedMovementGenerator.h"
 #include "TemporarySummon.h"
+#include "TickArena.h"
 #include "Tokenize.h"
 #include "Totem.h"
 #include "TotemAI.h"
@@ -106,6 +107,8 @@ static bool isNonTriggerAura[TOTAL_AURAS];
 static bool isAlwaysTriggeredAura[TOTAL_AURAS];
 // Prepare lists
 static bool procPrepared = InitTriggerAuraData();
+// Proc trigger flags of auras visited by every proc event
+static constexpr uint32 PROC_TRIGGER_FLAGS_ALWAYS = 0xFFFFFFFF;
 
 DamageInfo::DamageInfo(Unit* _attacker, Unit* _victim, uint32 _damage, SpellInfo const* _spellInfo, SpellSchoolMask _schoolMask, DamageEffectType _damageType, uint32 cleanDamage)
     : m_attacker(_attacker), m_victim(_victim), m_damage(_damage), m_spellInfo(_spellInfo), m_schoolMask(_schoolMask),
@@ -4449,6 +4452,10 @@ AuraApplication* Unit::_CreateAuraApplication(Aura* aura, uint8 effMask)
     AuraApplication* aurApp = new AuraApplication(this, caster, aura, effMask);
     m_appliedAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
 
+    aurApp->_procTriggerFlags = GetProcTriggerFlags(aura);
+    if (aurApp->_procTriggerFlags)
+        m_procTriggerAuras.insert(AuraApplicationMap::value_type(aurId, aurApp));
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: even if it gets removed, it will be reapplied in a second
     if (aurSpellInfo->AuraInterruptFlags && this == aura->GetOwner())
@@ -4545,6 +4552,19 @@ void Unit::_UnapplyAura(AuraApplicationMap::iterator& i, AuraRemoveMode removeMo
     // Remove all pointers from lists here to prevent possible pointer invalidation on spellcast/auraapply/auraremove
     m_appliedAuras.erase(i);
 
+    if (aurApp->GetProcTriggerFlags())
+    {
+        auto range = m_procTriggerAuras.equal_range(aura->GetId());
+        for (AuraApplicationMap::iterator itr = range.first; itr != range.second; ++itr)
+        {
+            if (itr->second == aurApp)
+            {
+                m_procTriggerAuras.erase(itr);
+                break;
+            }
+        }
+    }
+
     // xinef: do not insert our application to interruptible list if application target is not the owner (area auras)
     // xinef: event if it gets removed, it will be reapplied in a second
     if (aura->GetSpellInfo()->AuraInterruptFlags && this == aura->GetOwner())
@@ -16069,7 +16089,7 @@ struct ProcTriggeredData
     }
 };
 
-typedef std::list< ProcTriggeredData > ProcTriggeredList;
+typedef std::pmr::list< ProcTriggeredData > ProcTriggeredList;
 
 // List of auras that CAN be trigger but may not exist in spell_proc_event
 // in most case need for drop charges
@@ -16361,10 +16381,14 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
 
     ProcEventInfo eventInfo = ProcEventInfo(actor, actionTarget, target, procFlag, 0, procPhase, procExtra, procSpell, damageInfo, healInfo, procAura, procAuraEffectIndex);
 
-    ProcTriggeredList procTriggered;
-    // Fill procTriggered list
-    for (AuraApplicationMap::const_iterator itr = GetAppliedAuras().begin(); itr != GetAppliedAuras().end(); ++itr)
+    ProcTriggeredList procTriggered(Acore::GetTickArenaResource());
+    // Fill procTriggered list, from the applied auras that can be triggered by this event at all
+    for (AuraApplicationMap::const_iterator itr = m_procTriggerAuras.begin(); itr != m_procTriggerAuras.end(); ++itr)
     {
+        uint32 const procTriggerFlags = itr->second->GetProcTriggerFlags();
+        if (procTriggerFlags != PROC_TRIGGER_FLAGS_ALWAYS && !(procTriggerFlags & procFlag))
+            continue;
+
         // Do not allow auras to proc from effect triggered by itself
         if (procAura && procAura->Id == itr->first)
             continue;
@@ -16406,7 +16430,7 @@ void Unit::ProcDamageAndSpellFor(bool isVictim, Unit* target, uint32 procFlag, u
         }
 
         // do checks using conditions table
-        ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, spellProto->Id);
         ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
         if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
         {
@@ -17627,6 +17651,24 @@ bool Unit::InitTamedPet(Pet* pet, uint8 level, uint32 spell_id)
     return true;
 }
 
+uint32 Unit::GetProcTriggerFlags(Aura const* aura)
+{
+    // the proc check hooks of AuraScripts run for every event, whatever the proc flags are
+    if (aura->HasCheckProcScripts())
+        return PROC_TRIGGER_FLAGS_ALWAYS;
+
+    // same proc flags as IsTriggeredAtSpellProcEvent, auras of the new proc system never pass it
+    SpellInfo const* spellProto = aura->GetSpellInfo();
+    if (sSpellMgr->GetSpellProcEntry(spellProto->Id))
+        return 0;
+
+    if (SpellProcEventEntry const* spellProcEvent = sSpellMgr->GetSpellProcEvent(spellProto->Id))
+        if (spellProcEvent->procFlags)
+            return spellProcEvent->procFlags;
+
+    return spellProto->ProcFlags;
+}
+
 bool Unit::IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const*& spellProcEvent, ProcEventInfo const& eventInfo)
 {
     SpellInfo const* spellProto = aura->GetSpellInfo();
@@ -19286,12 +19328,10 @@ void Unit::SetPhaseMask(uint32 newPhaseMask, bool update)
             if (GetTypeId() != TYPEID_PLAYER)
             {
                 ThreatContainer::StorageType threatList = GetThreatMgr().GetThreatList();
-                ThreatContainer::StorageType offlineThreatList = GetThreatMgr().GetOfflineThreatList();
+                ThreatContainer::StorageType const& offlineThreatList = GetThreatMgr().GetOfflineThreatList();
 
-                // merge expects sorted lists
-                threatList.sort();
-                offlineThreatList.sort();
-                threatList.merge(offlineThreatList);
+                // copies, changing the online state moves references between both lists
+                threatList.insert(threatList.end(), offlineThreatList.begin(), offlineThreatList.end());
 
                 for (ThreatContainer::StorageType::const_iterator itr = threatList.begin(); itr != threatList.end(); ++itr)
                     if (Unit* unit = (*itr)->getTarget())
@@ -19769,7 +19809,7 @@ bool Unit::HandleSpellClick(Unit* clicker, int8 seatId)
             continue;
 
         //! Check database conditions
-        ConditionList conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
+        ConditionList const& conds = sConditionMgr->GetConditionsForSpellClickEvent(spellClickEntry, itr->second.spellId);
         ConditionSourceInfo info = ConditionSourceInfo(clicker, this);
         if (!sConditionMgr->IsObjectMeetToConditions(info, conds))
             continue;
@@ -21023,88 +21063,79 @@ void Unit::BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target)
 
     BuildValuesCachedBuffer cacheValue(500);
 
-    ByteBuffer fieldBuffer(400);
-
+    // special info fields are always sent to viewers allowed to see them
     UpdateMask updateMask;
-    updateMask.SetCount(m_valuesCount);
+    BuildValuesUpdateMask(updateMask, updateType, _changesMask, m_uint32Values, flags, visibleFlag, _fieldNotifyFlags | (visibleFlag & UF_FLAG_SPECIAL_INFO));
 
-    for (uint16 index = 0; index < m_valuesCount; ++index)
-    {
-        if (_fieldNotifyFlags & flags[index] ||
-                ((flags[index] & visibleFlag) & UF_FLAG_SPECIAL_INFO) ||
-                ((updateType == UPDATETYPE_VALUES ? _changesMask.GetBit(index) : m_uint32Values[index]) && (flags[index] & visibleFlag)) ||
-                (index == UNIT_FIELD_AURASTATE && HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK)))
-        {
-            updateMask.SetBit(index);
+    if (HasFlag(UNIT_FIELD_AURASTATE, PER_CASTER_AURA_STATE_MASK))
+        updateMask.SetBit(UNIT_FIELD_AURASTATE);
 
-            if (index == UNIT_NPC_FLAGS)
-            {
-                cacheValue.posPointers.UnitNPCFlagsPos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[UNIT_NPC_FLAGS];
-            }
-            else if (index == UNIT_FIELD_AURASTATE)
-            {
-                cacheValue.posPointers.UnitFieldAuraStatePos = int32(fieldBuffer.wpos());
-                fieldBuffer << uint32(0); // Fill in later.
-            }
-            // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
-            else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
-            {
-                // convert from float to uint32 and send
-                fieldBuffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
-            }
-            // there are some float values which may be negative or can't get negative due to other checks
-            else if ((index >= UNIT_FIELD_NEGSTAT0   && index <= UNIT_FIELD_NEGSTAT4) ||
-                     (index >= UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
-                     (index >= UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
-                     (index >= UNIT_FIELD_POSSTAT0   && index <= UNIT_FIELD_POSSTAT4))
-            {
-                fieldBuffer << uint32(m_floatValues[index]);
-            }
-            // Gamemasters should be always able to select units - remove not selectable flag
-            else if (index == UNIT_FIELD_FLAGS)
-            {
-                cacheValue.posPointers.UnitFieldFlagsPos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[UNIT_FIELD_FLAGS];
-            }
-            // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
-            else if (index == UNIT_FIELD_DISPLAYID)
-            {
-                cacheValue.posPointers.UnitFieldDisplayPos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[UNIT_FIELD_DISPLAYID];
-            }
-            else if (index == UNIT_DYNAMIC_FLAGS)
-            {
-                cacheValue.posPointers.UnitDynamicFlagsPos = int32(fieldBuffer.wpos());
-                uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
-                fieldBuffer << dynamicFlags;
-            }
-            else if (index == UNIT_FIELD_BYTES_2)
-            {
-                cacheValue.posPointers.UnitFieldBytes2Pos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[index];
-            }
-            else if (index == UNIT_FIELD_FACTIONTEMPLATE)
-            {
-                cacheValue.posPointers.UnitFieldFactionTemplatePos = int32(fieldBuffer.wpos());
-                fieldBuffer << m_uint32Values[index];
-            }
-            else
-            {
-                if (sScriptMgr->ShouldTrackValuesUpdatePosByIndex(this, updateType, index))
-                    cacheValue.posPointers.other[index] = static_cast<uint32>(fieldBuffer.wpos());
+    cacheValue.buffer << uint8(updateMask.GetBlockCount());
+    updateMask.AppendToPacket(&cacheValue.buffer);
 
-                // send in current format (float as float, uint32 as uint32)
-                fieldBuffer << m_uint32Values[index];
-            }
+    updateMask.ForEachSetBit([&](uint32 index)
+    {
+        if (index == UNIT_NPC_FLAGS)
+        {
+            cacheValue.posPointers.UnitNPCFlagsPos = int32(cacheValue.buffer.wpos());
+            cacheValue.buffer << m_uint32Values[UNIT_NPC_FLAGS];
         }
-    }
+        else if (index == UNIT_FIELD_AURASTATE)
+        {
+            cacheValue.posPointers.UnitFieldAuraStatePos = int32(cacheValue.buffer.wpos());
+            cacheValue.buffer << uint32(0); // Fill in later.
+        }
+        // FIXME: Some values at server stored in float format but must be sent to client in uint32 format
+        else if (index >= UNIT_FIELD_BASEATTACKTIME && index <= UNIT_FIELD_RANGEDATTACKTIME)
+        {
+            // convert from float to uint32 and send
+            cacheValue.buffer << uint32(m_floatValues[index] < 0 ? 0 : m_floatValues[index]);
+        }
+        // there are some float values which may be negative or can't get negative due to other checks
+        else if ((index >= UNIT_FIELD_NEGSTAT0   && index <= UNIT_FIELD_NEGSTAT4) ||
+                 (index >= UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSPOSITIVE + 6)) ||
+                 (index >= UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE  && index <= (UNIT_FIELD_RESISTANCEBUFFMODSNEGATIVE + 6)) ||
+                 (index >= UNIT_FIELD_POSSTAT0   && index <= UNIT_FIELD_POSSTAT4))
+        {
+            cacheValue.buffer << uint32(m_floatValues[index]);
+        }
+        // Gamemasters should be always able to select units - remove not selectable flag
+        else if (index == UNIT_FIELD_FLAGS)
+        {
+            cacheValue.posPointers.UnitFieldFlagsPos = int32(cacheValue.buffer.wpos());
+            cacheValue.buffer << m_uint32Values[UNIT_FIELD_FLAGS];
+        }
+        // use modelid_a if not gm, _h if gm for CREATURE_FLAG_EXTRA_TRIGGER creatures
+        else if (index == UNIT_FIELD_DISPLAYID)
+        {
+            cacheValue.posPointers.UnitFieldDisplayPos = int32(cacheValue.buffer.wpos());
+            cacheValue.buffer << m_uint32Values[UNIT_FIELD_DISPLAYID];
+        }
+        else if (index == UNIT_DYNAMIC_FLAGS)
+        {
+            cacheValue.posPointers.UnitDynamicFlagsPos = int32(cacheValue.buffer.wpos());
+            uint32 dynamicFlags = m_uint32Values[UNIT_DYNAMIC_FLAGS] & ~(UNIT_DYNFLAG_TAPPED | UNIT_DYNFLAG_TAPPED_BY_PLAYER);
+            cacheValue.buffer << dynamicFlags;
+        }
+        else if (index == UNIT_FIELD_BYTES_2)
+        {
+            cacheValue.posPointers.UnitFieldBytes2Pos = int32(cacheValue.buffer.wpos());
+            cacheValue.buffer << m_uint32Values[index];
+        }
+        else if (index == UNIT_FIELD_FACTIONTEMPLATE)
+        {
+            cacheValue.posPointers.UnitFieldFactionTemplatePos = int32(cacheValue.buffer.wpos());
+            cacheValue.buffer << m_uint32Values[index];
+        }
+        else
+        {
+            if (sScriptMgr->ShouldTrackValuesUpdatePosByIndex(this, updateType, index))
+                cacheValue.posPointers.other[index] = static_cast<uint32>(cacheValue.buffer.wpos());
 
-    cacheValue.buffer << uint8(updateMask.GetBlockCount());
-    updateMask.AppendToPacket(&cacheValue.buffer);
-    int32 fieldBufferPos = static_cast<int32>(cacheValue.buffer.wpos());
-    cacheValue.buffer.append(fieldBuffer);
-    cacheValue.posPointers.ApplyOffset(fieldBufferPos);
+            // send in current format (float as float, uint32 as uint32)
+            cacheValue.buffer << m_uint32Values[index];
+        }
+    });
 
     int32 cachePos = static_cast<int32>(data->wpos());
     data->append(cacheValue.buffer);
@@ -2561,6 +2561,8 @@ protected:
     explicit Unit (bool isWorldObject);
 
     void BuildValuesUpdate(uint8 updateType, ByteBuffer* data, Player* target) override;
+    // built from _valuesUpdateCache and patched for every viewer
+    [[nodiscard]] bool HasViewerDependentValuesUpdate() const override { return true; }
 
     UnitAI* i_AI, *i_disabledAI;
 
@@ -2596,6 +2598,7 @@ protected:
 
     AuraMap m_ownedAuras;
     AuraApplicationMap m_appliedAuras;
+    AuraApplicationMap m_procTriggerAuras;     // m_appliedAuras that ProcDamageAndSpellFor can trigger, same order
     AuraList m_removedAuras;
     AuraMap::iterator m_auraUpdateIterator;
     uint32 m_removedAurasCount;
@@ -2638,6 +2641,7 @@ protected:
     bool _instantCast;
 
 private:
+    static uint32 GetProcTriggerFlags(Aura const* aura);
     bool IsTriggeredAtSpellProcEvent(Unit* victim, Aura* aura, WeaponAttackType attType, bool isVictim, bool active, SpellProcEventEntry const*& spellProcEvent, ProcEventInfo const& eventInfo);
     bool HandleDummyAuraProc(Unit* victim, uint32 damage, AuraEffect* triggeredByAura, SpellInfo const* procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown, ProcEventInfo const& eventInfo);
     bool HandleAuraProc(Unit* victim, uint32 damage, Aura* triggeredByAura, SpellInfo const* procSpell, uint32 procFlag, uint32 procEx, uint32 cooldown, bool* handled);
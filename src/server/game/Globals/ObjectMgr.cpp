@@ -36,6 +36,7 @@
 #include "LFGMgr.h"
 #include "Log.h"
 #include "MapMgr.h"
+#include "Metric.h"
 #include "Pet.h"
 #include "PoolMgr.h"
 #include "ReputationMgr.h"
@@ -51,6 +52,7 @@
 #include "Util.h"
 #include "Vehicle.h"
 #include "World.h"
+#include "WorldDatabaseSnapshot.h"
 #include <boost/algorithm/string.hpp>
 #include <numeric>
 
@@ -522,7 +524,7 @@ void ObjectMgr::LoadCreatureTemplates()
     uint32 oldMSTime = getMSTime();
 
 //                                                   0      1                   2                   3                   4            5            6     7        8
-    QueryResult result = WorldDatabase.Query("SELECT entry, difficulty_entry_1, difficulty_entry_2, difficulty_entry_3, KillCredit1, KillCredit2, name, subname, IconName, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, difficulty_entry_1, difficulty_entry_2, difficulty_entry_3, KillCredit1, KillCredit2, name, subname, IconName, "
 //                        9               10        11        12   13       14       15          16         17          18            19               20     21      22
                          "gossip_menu_id, minlevel, maxlevel, exp, faction, npcflag, speed_walk, speed_run, speed_swim, speed_flight, detection_range, scale, `rank`, dmgschool, "
 //                        23              24              25               26            27             28          29          30           31            32      33            34
@@ -2107,7 +2109,7 @@ void ObjectMgr::LoadCreatures()
     uint32 oldMSTime = getMSTime();
 
     //                                                     0         1    2    3    4        5            6           7           8            9              10            11
-    QueryResult result = WorldDatabase.Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT creature.guid, id1, id2, id3, map, equipment_id, position_x, position_y, position_z, orientation, spawntimesecs, wander_distance, "
                          //      12            13       14          15           16         17         18          19             20                 21                    22
                          "currentwaypoint, curhealth, curmana, MovementType, spawnMask, phaseMask, eventEntry, pool_entry, creature.npcflag, creature.unit_flags, creature.dynamicflags, "
                          //       23
@@ -2436,7 +2438,7 @@ void ObjectMgr::LoadGameobjects()
     uint32 oldMSTime = getMSTime();
 
     //                                                0                1   2    3           4           5           6
-    QueryResult result = WorldDatabase.Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT gameobject.guid, id, map, position_x, position_y, position_z, orientation, "
                          //   7          8          9          10         11             12            13     14         15         16          17
                          "rotation0, rotation1, rotation2, rotation3, spawntimesecs, animprogress, state, spawnMask, phaseMask, eventEntry, pool_entry, "
                          //   18
@@ -2661,7 +2663,7 @@ void ObjectMgr::LoadItemTemplates()
     uint32 oldMSTime = getMSTime();
 
     //                                                 0      1       2               3              4        5        6       7          8         9        10        11           12
-    QueryResult result = WorldDatabase.Query("SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT entry, class, subclass, SoundOverrideSubclass, name, displayid, Quality, Flags, FlagsExtra, BuyCount, BuyPrice, SellPrice, InventoryType, "
                          //                                              13              14           15          16             17               18                19              20
                          "AllowableClass, AllowableRace, ItemLevel, RequiredLevel, RequiredSkill, RequiredSkillRank, requiredspell, requiredhonorrank, "
                          //                                              21                      22                       23               24        25          26             27           28
@@ -4360,7 +4362,7 @@ void ObjectMgr::LoadQuests()
 
     mExclusiveQuestGroups.clear();
 
-    QueryResult result = WorldDatabase.Query("SELECT "
+    QueryResult result = sWorldDatabaseSnapshot->Query("SELECT "
                          //0      1         2           3           4           5             6                 7            8
                          "ID, QuestType, QuestLevel, MinLevel, QuestSortID, QuestInfoID, SuggestedGroupNum, TimeAllowed, AllowableRaces,"
                          //      9                     10                   11                    12
@@ -6030,127 +6032,203 @@ void ObjectMgr::LoadNpcTextLocales()
     LOG_INFO("server.loading", ">> Loaded {} Npc Text Locale Strings in {} ms", (uint32)_npcTextLocaleStore.size(), GetMSTimeDiffToNow(oldMSTime));
 }
 
-void ObjectMgr::ReturnOrDeleteOldMails(bool serverUp)
+void ObjectMgr::ReturnOrDeleteOldMails()
 {
-    uint32 oldMSTime = getMSTime();
+    if (_expiredMailRun.Active)
+    {
+        LOG_DEBUG("server", "Expired mails are still being processed, skipping this pass.");
+        return;
+    }
+
+    _expiredMailRun = ExpiredMailRun();
+    _expiredMailRun.Active = true;
+    _expiredMailRun.Time = GameTime::GetGameTime().count();
+    _expiredMailRun.StartMSTime = getMSTime();
+
+    QueryExpiredMailChunk();
+}
 
-    time_t curTime = GameTime::GetGameTime().count();
+void ObjectMgr::QueryExpiredMailChunk()
+{
+    uint32 chunkSize = sWorld->getIntConfig(CONFIG_MAIL_EXPIRE_CHUNK_SIZE);
+    if (uint32 maxPerRun = sWorld->getIntConfig(CONFIG_MAIL_EXPIRE_MAX_PER_RUN))
+        chunkSize = std::min(chunkSize, maxPerRun - _expiredMailRun.Processed);
+
+    _expiredMailRun.ChunkSize = chunkSize;
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL);
-    stmt->SetData(0, uint32(curTime));
-    PreparedQueryResult result = CharacterDatabase.Query(stmt);
-    if (!result)
-        return;
+    stmt->SetData(0, uint32(_expiredMailRun.Time));
+    stmt->SetData(1, _expiredMailRun.LastMailId);
+    stmt->SetData(2, chunkSize);
 
-    std::map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
-    stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
-    stmt->SetData(0, uint32(curTime));
-    if (PreparedQueryResult items = CharacterDatabase.Query(stmt))
-    {
-        MailItemInfo item;
-        do
+    auto mails = std::make_shared<std::vector<ExpiredMail>>();
+    _expiredMailQueryProcessor.AddCallback(CharacterDatabase.AsyncQuery(stmt)
+        .WithChainingPreparedCallback([this, mails](QueryCallback& callback, PreparedQueryResult result)
         {
-            Field* fields = items->Fetch();
-            item.item_guid = fields[0].Get<uint32>();
-            item.item_template = fields[1].Get<uint32>();
-            uint32 mailId = fields[2].Get<uint32>();
-            itemsCache[mailId].push_back(item);
-        } while (items->NextRow());
-    }
+            if (!result)
+            {
+                FinishExpiredMailRun();
+                return;
+            }
 
-    uint32 deletedCount = 0;
-    uint32 returnedCount = 0;
-    do
+            bool hasItems = false;
+            mails->reserve(result->GetRowCount());
+            do
+            {
+                Field* fields = result->Fetch();
+                ExpiredMail& expired = mails->emplace_back();
+                Mail& m = expired.Data;
+                m.messageID      = fields[0].Get<uint32>();
+                m.messageType    = fields[1].Get<uint8>();
+                m.sender         = fields[2].Get<uint32>();
+                m.receiver       = fields[3].Get<uint32>();
+                expired.HasItems = fields[4].Get<bool>();
+                m.expire_time    = time_t(fields[5].Get<uint32>());
+                m.deliver_time   = time_t(0);
+                m.stationery     = fields[6].Get<uint8>();
+                m.checked        = fields[7].Get<uint8>();
+                m.mailTemplateId = fields[8].Get<int16>();
+                hasItems |= expired.HasItems;
+            } while (result->NextRow());
+
+            if (!hasItems)
+            {
+                ProcessExpiredMailChunk(*mails);
+                return;
+            }
+
+            // rows are ordered by id, only the items of this chunk are needed
+            CharacterDatabasePreparedStatement* itemsStmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_EXPIRED_MAIL_ITEMS);
+            itemsStmt->SetData(0, uint32(_expiredMailRun.Time));
+            itemsStmt->SetData(1, _expiredMailRun.LastMailId);
+            itemsStmt->SetData(2, mails->back().Data.messageID);
+            callback.SetNextQuery(CharacterDatabase.AsyncQuery(itemsStmt));
+        })
+        .WithPreparedCallback([this, mails](PreparedQueryResult items)
+        {
+            if (items)
+            {
+                std::unordered_map<uint32 /*messageId*/, MailItemInfoVec> itemsCache;
+                MailItemInfo item;
+                do
+                {
+                    Field* fields = items->Fetch();
+                    item.item_guid = fields[0].Get<uint32>();
+                    item.item_template = fields[1].Get<uint32>();
+                    uint32 mailId = fields[2].Get<uint32>();
+                    itemsCache[mailId].push_back(item);
+                } while (items->NextRow());
+
+                for (ExpiredMail& expired : *mails)
+                    if (expired.HasItems)
+                        expired.Data.items.swap(itemsCache[expired.Data.messageID]);
+            }
+
+            ProcessExpiredMailChunk(*mails);
+        }));
+}
+
+void ObjectMgr::ProcessExpiredMailChunk(std::vector<ExpiredMail>& mails)
+{
+    uint32 curTime = uint32(_expiredMailRun.Time);
+
+    CharacterDatabaseTransaction trans = CharacterDatabase.BeginTransaction();
+    for (ExpiredMail& expired : mails)
     {
-        Field* fields = result->Fetch();
-        Mail* m = new Mail;
-        m->messageID      = fields[0].Get<uint32>();
-        m->messageType    = fields[1].Get<uint8>();
-        m->sender         = fields[2].Get<uint32>();
-        m->receiver       = fields[3].Get<uint32>();
-        bool has_items    = fields[4].Get<bool>();
-        m->expire_time    = time_t(fields[5].Get<uint32>());
-        m->deliver_time   = time_t(0);
-        m->stationery     = fields[6].Get<uint8>();
-        m->checked        = fields[7].Get<uint8>();
-        m->mailTemplateId = fields[8].Get<int16>();
-
-        Player* player = nullptr;
-        if (serverUp)
-            player = ObjectAccessor::FindPlayerByLowGUID(m->receiver);
-
-        if (player) // don't modify mails of a logged in player
-        {
-            delete m;
+        Mail* m = &expired.Data;
+
+        // don't modify mails of a logged in player, the pass spans several world updates so players may log in meanwhile
+        if (ObjectAccessor::FindPlayerByLowGUID(m->receiver))
+        {
+            ++_expiredMailRun.Skipped;
             continue;
         }
 
         // Delete or return mail
-        if (has_items)
+        if (expired.HasItems)
         {
-            // read items from cache
-            m->items.swap(itemsCache[m->messageID]);
-
             // If it is mail from non-player, or if it's already return mail, it shouldn't be returned, but deleted
             if (!m->IsSentByPlayer() || m->IsSentByGM() || (m->IsCODPayment() || m->IsReturnedMail()))
             {
                 for (auto const& mailedItem : m->items)
                 {
-                    stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
+                    CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_ITEM_INSTANCE);
                     stmt->SetData(0, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
 
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
+                CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_ITEM_BY_ID);
                 stmt->SetData(0, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
             }
             else
             {
                 // Mail will be returned
-                stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
+                CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_RETURNED);
                 stmt->SetData(0, m->receiver);
                 stmt->SetData(1, m->sender);
                 stmt->SetData(2, uint32(curTime + 30 * DAY));
-                stmt->SetData(3, uint32(curTime));
-                stmt->SetData (4, uint8(MAIL_CHECK_MASK_RETURNED));
+                stmt->SetData(3, curTime);
+                stmt->SetData(4, uint8(MAIL_CHECK_MASK_RETURNED));
                 stmt->SetData(5, m->messageID);
-                CharacterDatabase.Execute(stmt);
+                trans->Append(stmt);
                 for (auto const& mailedItem : m->items)
                 {
                     // Update receiver in mail items for its proper delivery, and in instance_item for avoid lost item at sender delete
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_MAIL_ITEM_RECEIVER);
                     stmt->SetData(0, m->sender);
                     stmt->SetData(1, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
 
                     stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_ITEM_OWNER);
                     stmt->SetData(0, m->sender);
                     stmt->SetData(1, mailedItem.item_guid);
-                    CharacterDatabase.Execute(stmt);
+                    trans->Append(stmt);
                 }
 
                 // xinef: update global data
                 sCharacterCache->IncreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->sender));
                 sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->receiver));
 
-                delete m;
-                ++returnedCount;
+                ++_expiredMailRun.Returned;
                 continue;
             }
         }
 
         sCharacterCache->DecreaseCharacterMailCount(ObjectGuid(HighGuid::Player, m->receiver));
 
-        stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
+        CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_DEL_MAIL_BY_ID);
         stmt->SetData(0, m->messageID);
-        CharacterDatabase.Execute(stmt);
-        delete m;
-        ++deletedCount;
-    } while (result->NextRow());
+        trans->Append(stmt);
+        ++_expiredMailRun.Deleted;
+    }
 
-    LOG_INFO("server.loading", ">> Processed {} expired mails: {} deleted and {} returned in {} ms", deletedCount + returnedCount, deletedCount, returnedCount, GetMSTimeDiffToNow(oldMSTime));
-    LOG_INFO("server.loading", " ");
+    CharacterDatabase.CommitTransaction(trans);
+
+    ++_expiredMailRun.Chunks;
+    _expiredMailRun.Processed += mails.size();
+    _expiredMailRun.LastMailId = mails.back().Data.messageID;
+
+    METRIC_VALUE("expired_mails_processed", uint64(_expiredMailRun.Processed));
+    METRIC_VALUE("expired_mails_chunks", uint64(_expiredMailRun.Chunks));
+
+    uint32 maxPerRun = sWorld->getIntConfig(CONFIG_MAIL_EXPIRE_MAX_PER_RUN);
+    if (mails.size() < _expiredMailRun.ChunkSize || (maxPerRun && _expiredMailRun.Processed >= maxPerRun))
+        FinishExpiredMailRun();
+    else
+        QueryExpiredMailChunk();
+}
+
+void ObjectMgr::FinishExpiredMailRun()
+{
+    _expiredMailRun.Active = false;
+
+    if (!_expiredMailRun.Processed)
+        return;
+
+    LOG_INFO("server", ">> Processed {} expired mails in {} chunks: {} deleted, {} returned and {} skipped in {} ms",
+        _expiredMailRun.Processed, _expiredMailRun.Chunks, _expiredMailRun.Deleted, _expiredMailRun.Returned, _expiredMailRun.Skipped,
+        GetMSTimeDiffToNow(_expiredMailRun.StartMSTime));
 }
 
 void ObjectMgr::LoadQuestAreaTriggers()
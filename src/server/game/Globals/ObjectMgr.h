@@ -18,6 +18,7 @@
 #ifndef _OBJECTMGR_H
 #define _OBJECTMGR_H
 
+#include "AsyncCallbackProcessor.h"
 #include "Bag.h"
 #include "ConditionMgr.h"
 #include "Corpse.h"
@@ -1110,7 +1111,10 @@ public:
         return itr != _fishingBaseForAreaStore.end() ? itr->second : 0;
     }
 
-    void ReturnOrDeleteOldMails(bool serverUp);
+    /// Starts an asynchronous pass returning or deleting the expired mails in chunks, does nothing while a pass is running
+    void ReturnOrDeleteOldMails();
+    void ProcessExpiredMailCallbacks() { _expiredMailQueryProcessor.ProcessReadyCallbacks(); }
+    [[nodiscard]] bool IsReturningOrDeletingOldMails() const { return _expiredMailRun.Active; }
 
     CreatureBaseStats const* GetCreatureBaseStats(uint8 level, uint8 unitClass);
 
@@ -1533,6 +1537,33 @@ private:
 
     MailLevelRewardContainer _mailLevelRewardStore;
 
+    struct ExpiredMail
+    {
+        Mail Data;
+        bool HasItems;
+    };
+
+    struct ExpiredMailRun
+    {
+        bool Active = false;
+        time_t Time = 0;
+        uint32 LastMailId = 0;
+        uint32 ChunkSize = 0;
+        uint32 Processed = 0;
+        uint32 Deleted = 0;
+        uint32 Returned = 0;
+        uint32 Skipped = 0;
+        uint32 Chunks = 0;
+        uint32 StartMSTime = 0;
+    };
+
+    void QueryExpiredMailChunk();
+    void ProcessExpiredMailChunk(std::vector<ExpiredMail>& mails);
+    void FinishExpiredMailRun();
+
+    ExpiredMailRun _expiredMailRun;
+    QueryCallbackProcessor _expiredMailQueryProcessor;
+
     CreatureBaseStatsContainer _creatureBaseStatsStore;
 
     typedef std::map<uint32, PetLevelInfo*> PetLevelInfoContainer;
@@ -33,13 +33,22 @@ void VisibleNotifier::Visit(GameObjectMapType& m)
         if (i_largeOnly != go->IsVisibilityOverridden())
             continue;
 
-        vis_guids.erase(go->GetGUID());
+        i_seenGuids.push_back(go->GetGUID());
         i_player.UpdateVisibilityOf(go, i_data, i_visibleNow);
     }
 }
 
 void VisibleNotifier::SendToSelf()
 {
+    // objects the client knew but that were not visited are out of range, a set difference of
+    // two sorted vectors instead of erasing every visited object from a hashed copy of m_clientGUIDs
+    std::sort(i_seenGuids.begin(), i_seenGuids.end());
+
+    auto isSeen = [this](ObjectGuid guid)
+    {
+        return std::binary_search(i_seenGuids.begin(), i_seenGuids.end(), guid);
+    };
+
     // at this moment i_clientGUIDs have guids that not iterate at grid level checks
     // but exist one case when this possible and object not out of range: transports
     if (Transport* transport = i_player.GetTransport())
@@ -48,9 +57,10 @@ void VisibleNotifier::SendToSelf()
             if (i_largeOnly != (*itr)->IsVisibilityOverridden())
                 continue;
 
-            if (vis_guids.find((*itr)->GetGUID()) != vis_guids.end())
+            ObjectGuid const guid = (*itr)->GetGUID();
+            if (std::binary_search(i_clientGuids.begin(), i_clientGuids.end(), guid) && !isSeen(guid))
             {
-                vis_guids.erase((*itr)->GetGUID());
+                i_seenGuids.insert(std::lower_bound(i_seenGuids.begin(), i_seenGuids.end(), guid), guid);
 
                 switch ((*itr)->GetTypeId())
                 {
@@ -70,7 +80,10 @@ void VisibleNotifier::SendToSelf()
             }
         }
 
-    for (GuidUnorderedSet::const_iterator it = vis_guids.begin(); it != vis_guids.end(); ++it)
+    GuidPmrVector outOfRange(Acore::GetTickArenaResource());
+    std::set_difference(i_clientGuids.begin(), i_clientGuids.end(), i_seenGuids.begin(), i_seenGuids.end(), std::back_inserter(outOfRange));
+
+    for (GuidPmrVector::const_iterator it = outOfRange.begin(); it != outOfRange.end(); ++it)
     {
         if (WorldObject* obj = ObjectAccessor::GetWorldObject(i_player, *it))
         {
@@ -171,7 +184,7 @@ void PlayerRelocationNotifier::Visit(PlayerMapType& m)
     for (PlayerMapType::iterator iter = m.begin(); iter != m.end(); ++iter)
     {
         Player* player = iter->GetSource();
-        vis_guids.erase(player->GetGUID());
+        i_seenGuids.push_back(player->GetGUID());
         i_player.UpdateVisibilityOf(player, i_data, i_visibleNow);
         player->UpdateVisibilityOf(&i_player); // this notifier with different Visit(PlayerMapType&) than VisibleNotifier is needed to update visibility of self for other players when we move (eg. stealth detection changes)
     }
@@ -363,7 +376,7 @@ void ObjectUpdater::Visit(GridRefMgr<T>& m)
     {
         obj = iter->GetSource();
         ++iter;
-        if (obj->IsInWorld() && (i_largeOnly == obj->IsVisibilityOverridden()))
+        if (obj->IsInWorld() && !obj->IsRespawnDormant() && (i_largeOnly == obj->IsVisibilityOverridden()))
             obj->Update(i_timeDiff);
     }
 }
@@ -28,9 +28,11 @@
 #include "Optional.h"
 #include "Player.h"
 #include "Spell.h"
+#include "TickArena.h"
 #include "Unit.h"
 #include "UpdateData.h"
 #include "WorldSession.h"
+#include <algorithm>
 #include <iostream>
 
 #include "SpellMgr.h"
@@ -43,15 +45,19 @@ namespace Acore
     struct VisibleNotifier
     {
         Player& i_player;
-        GuidUnorderedSet vis_guids;
+        GuidPmrVector i_clientGuids; // m_clientGUIDs when the notifier started, sorted
+        GuidPmrVector i_seenGuids;   // objects visited by this notifier, sorted in SendToSelf
         std::vector<Unit*>& i_visibleNow;
         bool i_gobjOnly;
         bool i_largeOnly;
         UpdateData i_data;
 
         VisibleNotifier(Player& player, bool gobjOnly, bool largeOnly) :
-            i_player(player), vis_guids(player.m_clientGUIDs), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_largeOnly(largeOnly)
+            i_player(player), i_clientGuids(player.m_clientGUIDs.begin(), player.m_clientGUIDs.end(), Acore::GetTickArenaResource()),
+            i_seenGuids(Acore::GetTickArenaResource()), i_visibleNow(player.m_newVisible), i_gobjOnly(gobjOnly), i_largeOnly(largeOnly)
         {
+            std::sort(i_clientGuids.begin(), i_clientGuids.end());
+            i_seenGuids.reserve(i_clientGuids.size());
             i_visibleNow.clear();
         }
 
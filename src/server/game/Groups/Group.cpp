@@ -1738,20 +1738,40 @@ void Group::SendUpdateToPlayer(ObjectGuid playerGUID, MemberSlot* slot)
     player->GetSession()->SendPacket(&data);
 }
 
-void Group::UpdatePlayerOutOfRange(Player* player)
+uint32 Group::UpdatePlayerOutOfRange(Player* player)
 {
     if (!player || !player->IsInWorld())
-        return;
+        return 0;
 
+    // built once on the first receiver and shared by all of them
     WorldPacket data;
-    player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &data);
+    bool sameMapReceiver = false;
+    bool otherMapReceiver = false;
 
     for (GroupReference* itr = GetFirstMember(); itr != nullptr; itr = itr->next())
     {
         Player* member = itr->GetSource();
-        if (member && (!member->IsInMap(player) || !member->IsWithinDist(player, member->GetSightRange(player), false)))
-            member->GetSession()->SendPacket(&data);
+        if (!member)
+            continue;
+
+        bool const sameMap = member->IsInMap(player);
+        if (sameMap && member->IsWithinDist(player, member->GetSightRange(player), false))
+            continue;
+
+        if (!sameMapReceiver && !otherMapReceiver)
+            player->GetSession()->BuildPartyMemberStatsChangedPacket(player, &data);
+
+        (sameMap ? sameMapReceiver : otherMapReceiver) = true;
+        member->GetSession()->SendPacket(&data);
     }
+
+    if (sameMapReceiver)
+        return sWorld->getIntConfig(CONFIG_GROUP_MEMBER_STATS_INTERVAL);
+
+    if (otherMapReceiver)
+        return sWorld->getIntConfig(CONFIG_GROUP_MEMBER_STATS_INTERVAL_OTHER_MAP);
+
+    return 0;
 }
 
 void Group::BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group, ObjectGuid ignore)
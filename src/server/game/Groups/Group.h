@@ -273,7 +273,8 @@ public:
     void SendTargetIconList(WorldSession* session);
     void SendUpdate();
     void SendUpdateToPlayer(ObjectGuid playerGUID, MemberSlot* slot = nullptr);
-    void UpdatePlayerOutOfRange(Player* player);
+    // returns the time until the next stats update of player should be sent, depending on where the receivers are
+    uint32 UpdatePlayerOutOfRange(Player* player);
     // ignore: GUID of player that will be ignored
     void BroadcastPacket(WorldPacket const* packet, bool ignorePlayersInBGRaid, int group = -1, ObjectGuid ignore = ObjectGuid::Empty);
     void BroadcastReadyCheck(WorldPacket const* packet);
@@ -545,10 +545,13 @@ void WorldSession::HandleCalendarEventInvite(WorldPacket& recvData)
     }
     else
     {
+        if (DeferUntilCharacterCacheLoaded(recvData, name))
+            return;
+
         // xinef: Get Data From global storage
         if (ObjectGuid guid = sCharacterCache->GetCharacterGuidByName(name))
         {
-            if (CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(guid))
+            if (Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(guid))
             {
                 inviteeGuid = guid;
                 inviteeTeamId = Player::TeamIdForRace(playerData->Race);
@@ -231,6 +231,10 @@ void WorldSession::HandleChannelBan(WorldPacket& recvPacket)
     if (!normalizePlayerName(targetName))
         return;
 
+    // offline targets are looked up in the character cache
+    if (DeferUntilCharacterCacheLoaded(recvPacket, targetName))
+        return;
+
     if (ChannelMgr* cMgr = ChannelMgr::forTeam(GetPlayer()->GetTeamId()))
         if (Channel* channel = cMgr->GetChannel(channelName, GetPlayer()))
             channel->Ban(GetPlayer(), targetName);
@@ -246,6 +250,10 @@ void WorldSession::HandleChannelUnban(WorldPacket& recvPacket)
     if (!normalizePlayerName(targetName))
         return;
 
+    // offline targets are looked up in the character cache
+    if (DeferUntilCharacterCacheLoaded(recvPacket, targetName))
+        return;
+
     if (ChannelMgr* cMgr = ChannelMgr::forTeam(GetPlayer()->GetTeamId()))
         if (Channel* channel = cMgr->GetChannel(channelName, GetPlayer()))
             channel->UnBan(GetPlayer(), targetName);
@@ -42,6 +42,7 @@
 #include "Pet.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerLoginAdmission.h"
 #include "QueryHolder.h"
 #include "Realm.h"
 #include "ReputationMgr.h"
@@ -279,6 +280,10 @@ void WorldSession::HandleCharCreateOpcode(WorldPacket& recvData)
              >> createInfo->FacialHair
              >> createInfo->OutfitId;
 
+    // the name is checked against the character cache before the character is saved
+    if (DeferUntilCharacterCacheLoaded(recvData, createInfo->Name))
+        return;
+
     if (AccountMgr::IsPlayerAccount(GetSecurity()))
     {
         if (uint32 mask = sWorld->getIntConfig(CONFIG_CHARACTER_CREATING_DISABLED))
@@ -605,6 +610,9 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
     ObjectGuid guid;
     recvData >> guid;
 
+    if (DeferUntilCharacterCacheLoaded(recvData, guid))
+        return;
+
     // Initiating
     uint32 initAccountId = GetAccountId();
 
@@ -635,7 +643,7 @@ void WorldSession::HandleCharDeleteOpcode(WorldPacket& recvData)
         return;
     }
 
-    if (CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(guid))
+    if (Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(guid))
     {
         accountId = playerData->AccountId;
         name = playerData->Name;
@@ -687,6 +695,10 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         return;
     }
 
+    // characters not resident in a paged character cache are loaded before the login looks up their guild and groups
+    if (DeferUntilCharacterCacheLoaded(recvData, playerGuid))
+        return;
+
     auto SendCharLogin = [&](ResponseCodes result)
     {
         WorldPacket data(SMSG_CHARACTER_LOGIN_FAILED, 1);
@@ -774,14 +786,37 @@ void WorldSession::HandlePlayerLoginOpcode(WorldPacket& recvData)
         }
     }
 
+    // a login of this session is already waiting or loading
+    if (!_pendingLoginGuid.IsEmpty() || _loginAdmitted)
+        return;
+
+    // the character data is only loaded once PlayerLoginAdmission has room for another login, until then m_playerLoading stays set
+    _loginStageMSTime = getMSTime();
+    if (!sPlayerLoginAdmission->RequestAdmission(_loginAdmissionTicket))
+    {
+        _pendingLoginGuid = playerGuid;
+        return;
+    }
+
+    _loginAdmitted = true;
+    LoadPlayerLoginData(playerGuid);
+}
+
+void WorldSession::LoadPlayerLoginData(ObjectGuid playerGuid)
+{
     std::shared_ptr<LoginQueryHolder> holder = std::make_shared<LoginQueryHolder>(GetAccountId(), playerGuid);
     if (!holder->Initialize())
     {
+        _loginAdmitted = false;
+        sPlayerLoginAdmission->OnLoginAborted();
         m_playerLoading = false;
         return;
     }
 
-    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder)).AfterComplete([this](SQLQueryHolderBase const& holder)
+    _loginStageMSTime = getMSTime();
+
+    // the holder queries are spread over several connections, the last one finishing completes the holder
+    AddQueryHolderCallback(CharacterDatabase.DelayQueryHolder(holder, sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_QUERY_PARTS))).AfterComplete([this](SQLQueryHolderBase const& holder)
     {
         HandlePlayerLoginFromDB(static_cast<LoginQueryHolder const&>(holder));
     });
@@ -791,6 +826,12 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 {
     ObjectGuid playerGuid = holder.GetGuid();
 
+    uint32 databaseTime = GetMSTimeDiffToNow(_loginStageMSTime);
+    METRIC_VALUE("player_login_stage", uint64(databaseTime), METRIC_TAG("stage", "database"));
+    _loginAdmitted = false;
+    sPlayerLoginAdmission->OnLoginLoaded(databaseTime);
+    _loginStageMSTime = getMSTime();
+
     Player* pCurrChar = new Player(this);
     // for send server info and strings (config)
     ChatHandler chH = ChatHandler(pCurrChar->GetSession());
@@ -883,6 +924,9 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
         }
     }
 
+    METRIC_VALUE("player_login_stage", uint64(GetMSTimeDiffToNow(_loginStageMSTime)), METRIC_TAG("stage", "load"));
+    _loginStageMSTime = getMSTime();
+
     // Xinef: moved this from below
     ObjectAccessor::AddObject(pCurrChar);
 
@@ -900,6 +944,8 @@ void WorldSession::HandlePlayerLoginFromDB(LoginQueryHolder const& holder)
 
     pCurrChar->SendInitialPacketsAfterAddToMap();
 
+    METRIC_VALUE("player_login_stage", uint64(GetMSTimeDiffToNow(_loginStageMSTime)), METRIC_TAG("stage", "enter"));
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_UPD_CHAR_ONLINE);
     stmt->SetData(0, pCurrChar->GetGUID().GetCounter());
     CharacterDatabase.Execute(stmt);
@@ -1421,6 +1467,9 @@ void WorldSession::HandleSetPlayerDeclinedNames(WorldPacket& recvData)
     ObjectGuid guid;
     recvData >> guid;
 
+    if (DeferUntilCharacterCacheLoaded(recvData, guid))
+        return;
+
     // not accept declined names for unsupported languages
     std::string name;
     if (!sCharacterCache->GetCharacterNameByGuid(guid, name))
@@ -1636,6 +1685,10 @@ void WorldSession::HandleCharCustomize(WorldPacket& recvData)
              >> customizeInfo->FacialHair
              >> customizeInfo->Face;
 
+    // the callback reads the current and the new name from the character cache
+    if (DeferUntilCharacterCacheLoaded(recvData, customizeInfo->Guid) || DeferUntilCharacterCacheLoaded(recvData, customizeInfo->Name))
+        return;
+
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_CUSTOMIZE_INFO);
     stmt->SetData(0, customizeInfo->Guid.GetCounter());
 
@@ -1652,7 +1705,7 @@ void WorldSession::HandleCharCustomizeCallback(std::shared_ptr<CharacterCustomiz
     }
 
     // get the players old (at this moment current) race
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(customizeInfo->Guid);
+    Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(customizeInfo->Guid);
     if (!playerData)
     {
         SendCharCustomize(CHAR_CREATE_ERROR, customizeInfo.get());
@@ -1927,6 +1980,10 @@ void WorldSession::HandleCharFactionOrRaceChange(WorldPacket& recvData)
         return;
     }
 
+    // the callback reads the current and the new name from the character cache
+    if (DeferUntilCharacterCacheLoaded(recvData, factionChangeInfo->Guid) || DeferUntilCharacterCacheLoaded(recvData, factionChangeInfo->Name))
+        return;
+
     factionChangeInfo->FactionChange = (recvData.GetOpcode() == CMSG_CHAR_FACTION_CHANGE);
 
     CharacterDatabasePreparedStatement* stmt = CharacterDatabase.GetPreparedStatement(CHAR_SEL_CHAR_RACE_OR_FACTION_CHANGE_INFOS);
@@ -1947,7 +2004,7 @@ void WorldSession::HandleCharFactionOrRaceChangeCallback(std::shared_ptr<Charact
     ObjectGuid::LowType lowGuid = factionChangeInfo->Guid.GetCounter();
 
     // get the players old (at this moment current) race
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(factionChangeInfo->Guid);
+    Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(factionChangeInfo->Guid);
     if (!playerData)
     {
         SendCharFactionChange(CHAR_CREATE_ERROR, factionChangeInfo.get());
@@ -308,6 +308,9 @@ void WorldSession::HandleGroupUninviteGuidOpcode(WorldPacket& recvData)
         return;
     }
 
+    if (DeferUntilCharacterCacheLoaded(recvData, guid))
+        return;
+
     sCharacterCache->GetCharacterNameByGuid(guid, name);
 
     PartyResult res = GetPlayer()->CanUninviteFromGroup(guid);
@@ -649,6 +652,9 @@ void WorldSession::HandleGroupChangeSubGroupOpcode(WorldPacket& recvData)
     else
     {
         CharacterDatabase.EscapeString(name);
+        if (DeferUntilCharacterCacheLoaded(recvData, name))
+            return;
+
         guid = sCharacterCache->GetCharacterGuidByName(name);
     }
 
@@ -124,6 +124,9 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
     ObjectGuid receiverGuid;
     if (normalizePlayerName(receiver))
     {
+        if (DeferUntilCharacterCacheLoaded(recvData, receiver))
+            return;
+
         receiverGuid = sCharacterCache->GetCharacterGuidByName(receiver);
     }
 
@@ -181,7 +184,7 @@ void WorldSession::HandleSendMail(WorldPacket& recvData)
     else
     {
         // xinef: get data from global storage
-        if (CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(receiverGuid))
+        if (Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(receiverGuid))
         {
             rc_teamId = Player::TeamIdForRace(playerData->Race);
             mails_count = playerData->MailCount;
@@ -416,6 +419,10 @@ void WorldSession::HandleMailReturnToSender(WorldPacket& recvData)
         return;
     }
 
+    // the mail is only returned if the sender still exists, look them up before deleting it
+    if (m->messageType == MAIL_NORMAL && m->sender && DeferUntilCharacterCacheLoaded(recvData, ObjectGuid(HighGuid::Player, m->sender)))
+        return;
+
     if (m->HasItems())
     {
         for (MailItemInfoVec::iterator itr = m->items.begin(); itr != m->items.end(); ++itr)
@@ -520,6 +527,10 @@ void WorldSession::HandleMailTakeItem(WorldPacket& recvData)
         return;
     }
 
+    // the COD payment is mailed to the sender, look them up before taking the item
+    if (m->COD > 0 && DeferUntilCharacterCacheLoaded(recvData, ObjectGuid(HighGuid::Player, m->sender)))
+        return;
+
     Item* it = player->GetMItem(itemLowGuid);
 
     ItemPosCountVec dest;
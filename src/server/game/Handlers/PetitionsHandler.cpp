@@ -413,6 +413,10 @@ void WorldSession::HandlePetitionSignOpcode(WorldPacket& recvData)
     if (!signatures)
         return;
 
+    // the team of the owner comes from the character cache
+    if (DeferUntilCharacterCacheLoaded(recvData, petition->ownerGuid))
+        return;
+
     if (type != GUILD_CHARTER_TYPE)
     {
         if (!sWorld->getBoolConfig(CONFIG_ALLOW_TWO_SIDE_INTERACTION_ARENA) && GetPlayer()->GetTeamId() != sCharacterCache->GetCharacterTeamByGuid(petition->ownerGuid))
@@ -734,6 +738,11 @@ void WorldSession::HandleTurnInPetitionOpcode(WorldPacket& recvData)
         return;
     }
 
+    // the signers are added through the character cache, page them in before anything is created
+    for (SignatureMap::const_iterator itr = signatureCopy.begin(); itr != signatureCopy.end(); ++itr)
+        if (DeferUntilCharacterCacheLoaded(recvData, itr->first))
+            return;
+
     // Proceed with guild/arena team creation
 
     // Delete charter item
@@ -28,40 +28,46 @@
 #include "WorldPacket.h"
 #include "WorldSession.h"
 
-void WorldSession::SendNameQueryOpcode(ObjectGuid guid)
+namespace
 {
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(guid);
-
-    WorldPacket data(SMSG_NAME_QUERY_RESPONSE, (8 + 1 + 1 + 1 + 1 + 1 + 10));
-    data << guid.WriteAsPacked();
-    if (!playerData)
+    void SendNameQueryResponse(WorldSession* session, ObjectGuid guid, Optional<CharacterCacheEntry> const& playerData)
     {
-        data << uint8(1);                           // name unknown
-        SendPacket(&data);
-        return;
-    }
+        WorldPacket data(SMSG_NAME_QUERY_RESPONSE, (8 + 1 + 1 + 1 + 1 + 1 + 10));
+        data << guid.WriteAsPacked();
+        if (!playerData)
+        {
+            data << uint8(1);                           // name unknown
+            session->SendPacket(&data);
+            return;
+        }
 
-    Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+        Player* player = ObjectAccessor::FindConnectedPlayer(guid);
 
-    data << uint8(0);                               // name known
-    data << playerData->Name;                       // played name
-    data << uint8(0);                               // realm name - only set for cross realm interaction (such as Battlegrounds)
-    data << uint8(player ? player->getRace() : playerData->Race);
-    data << uint8(playerData->Sex);
-    data << uint8(playerData->Class);
+        data << uint8(0);                               // name known
+        data << playerData->Name;                       // played name
+        data << uint8(0);                               // realm name - only set for cross realm interaction (such as Battlegrounds)
+        data << uint8(player ? player->getRace() : playerData->Race);
+        data << uint8(playerData->Sex);
+        data << uint8(playerData->Class);
 
-    // pussywizard: optimization
-    /*Player* player = ObjectAccessor::FindConnectedPlayer(guid);
-    if (DeclinedName const* names = (player ? player->GetDeclinedNames() : nullptr))
-    {
-        data << uint8(1);                           // Name is declined
-        for (uint8 i = 0; i < MAX_DECLINED_NAME_CASES; ++i)
-            data << names->name[i];
+        // pussywizard: optimization
+        /*Player* player = ObjectAccessor::FindConnectedPlayer(guid);
+        if (DeclinedName const* names = (player ? player->GetDeclinedNames() : nullptr))
+        {
+            data << uint8(1);                           // Name is declined
+            for (uint8 i = 0; i < MAX_DECLINED_NAME_CASES; ++i)
+                data << names->name[i];
+        }
+        else*/
+        data << uint8(0);                           // Name is not declined
+
+        session->SendPacket(&data);
     }
-    else*/
-    data << uint8(0);                           // Name is not declined
+}
 
-    SendPacket(&data);
+void WorldSession::SendNameQueryOpcode(ObjectGuid guid)
+{
+    SendNameQueryResponse(this, guid, sCharacterCache->GetCharacterCacheByGuid(guid));
 }
 
 void WorldSession::HandleNameQueryOpcode(WorldPacket& recvData)
@@ -72,6 +78,16 @@ void WorldSession::HandleNameQueryOpcode(WorldPacket& recvData)
     // This is disable by default to prevent lots of console spam
     // LOG_INFO("network.opcode", "HandleNameQueryOpcode {}", guid);
 
+    // names of characters not loaded into a paged character cache are looked up without blocking the map
+    if (!sCharacterCache->IsCharacterCacheEntryLoaded(guid))
+    {
+        sCharacterCache->LoadCharacterCacheEntryAsync(guid, GetQueryProcessor(), [this, guid](Optional<CharacterCacheEntry> const& playerData)
+        {
+            SendNameQueryResponse(this, guid, playerData);
+        });
+        return;
+    }
+
     SendNameQueryOpcode(guid);
 }
 
@@ -45,11 +45,14 @@ void WorldSession::HandleAddFriendOpcode(WorldPacket& recv_data)
     if (!normalizePlayerName(friendName))
         return;
 
+    if (DeferUntilCharacterCacheLoaded(recv_data, friendName))
+        return;
+
     ObjectGuid friendGuid = sCharacterCache->GetCharacterGuidByName(friendName);
     if (!friendGuid)
         return;
 
-    CharacterCacheEntry const* playerData = sCharacterCache->GetCharacterCacheByGuid(friendGuid);
+    Optional<CharacterCacheEntry> playerData = sCharacterCache->GetCharacterCacheByGuid(friendGuid);
     if (!playerData)
         return;
 
@@ -111,6 +114,9 @@ void WorldSession::HandleAddIgnoreOpcode(WorldPacket& recv_data)
 
     LOG_DEBUG("network", "WORLD: {} asked to Ignore: '{}'", GetPlayer()->GetName(), ignoreName);
 
+    if (DeferUntilCharacterCacheLoaded(recv_data, ignoreName))
+        return;
+
     ObjectGuid ignoreGuid = sCharacterCache->GetCharacterGuidByName(ignoreName);
     if (!ignoreGuid)
         return;
@@ -21,6 +21,7 @@
 #include "Chat.h"
 #include "DisableMgr.h"
 #include "DynamicTree.h"
+#include "GameObjectModel.h"
 #include "GameTime.h"
 #include "Geometry.h"
 #include "GridNotifiers.h"
@@ -36,6 +37,7 @@
 #include "ObjectMgr.h"
 #include "Pet.h"
 #include "ScriptMgr.h"
+#include "TickArena.h"
 #include "Transport.h"
 #include "VMapFactory.h"
 #include "Vehicle.h"
@@ -235,6 +237,7 @@ void Map::LoadMapAndVMap(int gx, int gy)
 Map::Map(uint32 id, uint32 InstanceId, uint8 SpawnMode, Map* _parent) :
     i_mapEntry(sMapStore.LookupEntry(id)), i_spawnMode(SpawnMode), i_InstanceId(InstanceId),
     m_unloadTimer(0), m_VisibleDistance(DEFAULT_VISIBILITY_DISTANCE),
+    _collisionCache(sWorld->getIntConfig(CONFIG_VMAP_COLLISION_CACHE_SIZE)),
     _instanceResetPeriod(0), m_activeNonPlayersIter(m_activeNonPlayers.end()),
     _transportsUpdateIter(_transports.end()), i_scriptLock(false), _defaultLight(GetDefaultMapLight(id))
 {
@@ -460,6 +463,9 @@ void Map::EnsureGridCreated_i(const GridCoord& p)
 
         // pussywizard: moved here
         setNGrid(ngt, p.x_coord, p.y_coord);
+
+        // freshly loaded terrain and vmap tiles change collision results around the grid
+        InvalidateCollisionCache();
     }
 }
 
@@ -735,6 +741,9 @@ void Map::VisitNearbyCellsOf(WorldObject* obj, TypeContainerVisitor<Acore::Objec
 
 void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
 {
+    // short lived containers of this update are allocated from the arena of the map thread, released at the end of the update
+    Acore::TickArenaScope tickArena;
+
     if (t_diff)
         _dynamicTree.update(t_diff);
 
@@ -770,6 +779,8 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
         return;
     }
 
+    uint32 respawnWakeUps = ProcessRespawnQueue();
+
     /// update active cells around players and active objects
     resetMarkedCells();
     resetMarkedCellsLarge();
@@ -885,6 +896,39 @@ void Map::Update(const uint32 t_diff, const uint32 s_diff, bool  /*thread*/)
     METRIC_VALUE("map_gameobjects", uint64(GetObjectsStore().Size<GameObject>()),
         METRIC_TAG("map_id", std::to_string(GetId())),
         METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_respawn_queue", uint64(_respawnQueue.size()),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_respawn_wakeups", uint64(respawnWakeUps),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    if (_collisionCache.IsEnabled())
+    {
+        METRIC_VALUE("map_collision_cache_hits", uint64(_collisionCache.GetHits()),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_collision_cache_misses", uint64(_collisionCache.GetMisses()),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        METRIC_VALUE("map_collision_cache_invalidations", uint64(_collisionCache.GetInvalidations()),
+            METRIC_TAG("map_id", std::to_string(GetId())),
+            METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+        _collisionCache.ResetStats();
+    }
+
+    METRIC_VALUE("map_arena_allocations", tickArena.GetAllocations(),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
+
+    METRIC_VALUE("map_arena_bytes", tickArena.GetAllocatedBytes(),
+        METRIC_TAG("map_id", std::to_string(GetId())),
+        METRIC_TAG("map_instanceid", std::to_string(GetInstanceId())));
 }
 
 void Map::HandleDelayedVisibility()
@@ -1082,6 +1126,85 @@ void Map::DynamicObjectRelocation(DynamicObject* dynObj, float x, float y, float
     dynObj->UpdateObjectVisibility(false);
 }
 
+void Map::TransportPassengerRelocation(WorldObject* passenger, float x, float y, float z, float o, bool updateVisibility)
+{
+    Cell old_cell;
+    switch (passenger->GetTypeId())
+    {
+        case TYPEID_UNIT:
+            old_cell = passenger->ToCreature()->GetCurrentCell();
+            break;
+        case TYPEID_PLAYER:
+            old_cell = Cell(passenger->GetPositionX(), passenger->GetPositionY());
+            break;
+        case TYPEID_GAMEOBJECT:
+            old_cell = passenger->ToGameObject()->GetCurrentCell();
+            break;
+        case TYPEID_DYNAMICOBJECT:
+            old_cell = passenger->ToDynObject()->GetCurrentCell();
+            break;
+        default:
+            return;
+    }
+
+    Cell const new_cell(x, y);
+
+    if (old_cell.DiffGrid(new_cell) || old_cell.DiffCell(new_cell))
+    {
+        switch (passenger->GetTypeId())
+        {
+            case TYPEID_UNIT:
+                CreatureRelocation(passenger->ToCreature(), x, y, z, o);
+                break;
+            case TYPEID_PLAYER:
+                PlayerRelocation(passenger->ToPlayer(), x, y, z, o);
+                break;
+            case TYPEID_GAMEOBJECT:
+                GameObjectRelocation(passenger->ToGameObject(), x, y, z, o);
+                break;
+            case TYPEID_DYNAMICOBJECT:
+                DynamicObjectRelocation(passenger->ToDynObject(), x, y, z, o);
+                break;
+            default:
+                break;
+        }
+        return;
+    }
+
+    switch (passenger->GetTypeId())
+    {
+        case TYPEID_UNIT:
+            RemoveCreatureFromMoveList(passenger->ToCreature());
+            break;
+        case TYPEID_GAMEOBJECT:
+            RemoveGameObjectFromMoveList(passenger->ToGameObject());
+            break;
+        case TYPEID_DYNAMICOBJECT:
+            RemoveDynamicObjectFromMoveList(passenger->ToDynObject());
+            break;
+        default:
+            break;
+    }
+
+    passenger->Relocate(x, y, z, o);
+
+    if (Unit* unit = passenger->ToUnit())
+    {
+        if (unit->IsVehicle())
+            unit->GetVehicleKit()->RelocatePassengers();
+    }
+    else if (GameObject* go = passenger->ToGameObject())
+        go->UpdateModelPosition();
+
+    // zone, area, floor and liquid are looked up when they are needed, not on every transport step
+    passenger->SetPositionDataUpdate();
+
+    // units only schedule the delayed relocation notifier, game objects and dynamic objects
+    // would visit the surrounding cells right away so the transport rate limits them
+    if (passenger->ToUnit() || updateVisibility)
+        passenger->UpdateObjectVisibility(false);
+}
+
 void Map::AddCreatureToMoveList(Creature* c)
 {
     if (c->_moveState == MAP_OBJECT_CELL_MOVE_NONE)
@@ -1250,6 +1373,7 @@ bool Map::UnloadGrid(NGridType& ngrid)
     }
 
     GridMaps[gx][gy] = nullptr;
+    InvalidateCollisionCache();
 
     LOG_DEBUG("maps", "Unloading grid[{}, {}] for map {} finished", x, y, GetId());
     return true;
@@ -2435,6 +2559,13 @@ float Map::GetWaterLevel(float x, float y) const
         return 0;
 }
 
+void Map::InvalidateCollisionCache(GameObjectModel const& model)
+{
+    // only queries crossing the model (old or new position) can change
+    G3D::AABox const& bounds = model.GetBounds();
+    _collisionCache.InvalidateRegion(bounds.low().x, bounds.low().y, bounds.high().x, bounds.high().y);
+}
+
 bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
 {
     if (!sWorld->getBoolConfig(CONFIG_VMAP_BLIZZLIKE_PVP_LOS))
@@ -2453,6 +2584,21 @@ bool Map::isInLineOfSight(float x1, float y1, float z1, float x2, float y2, floa
         }
     }
 
+    uint32 cacheFlags = uint32(checks) | (uint32(ignoreFlags) << 8);
+    if (sWorld->getBoolConfig(CONFIG_CHECK_GOBJECT_LOS))
+        cacheFlags |= 0x10000;
+
+    bool result;
+    if (_collisionCache.GetLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, cacheFlags, result))
+        return result;
+
+    result = CalculateLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, checks, ignoreFlags);
+    _collisionCache.StoreLineOfSight(x1, y1, z1, x2, y2, z2, phasemask, cacheFlags, result);
+    return result;
+}
+
+bool Map::CalculateLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const
+{
     if ((checks & LINEOFSIGHT_CHECK_VMAP) && !VMAP::VMapFactory::createOrGetVMapMgr()->isInLineOfSight(GetId(), x1, y1, z1, x2, y2, z2, ignoreFlags))
     {
         return false;
@@ -2491,10 +2637,16 @@ bool Map::GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float
 
 float Map::GetHeight(uint32 phasemask, float x, float y, float z, bool vmap/*=true*/, float maxSearchDist /*= DEFAULT_HEIGHT_SEARCH*/) const
 {
+    float height;
+    if (_collisionCache.GetHeight(x, y, z, maxSearchDist, phasemask, vmap ? 1 : 0, height))
+        return height;
+
     float h1, h2;
     h1 = GetHeight(x, y, z, vmap, maxSearchDist);
     h2 = _dynamicTree.getHeight(x, y, z, maxSearchDist, phasemask);
-    return std::max<float>(h1, h2);
+    height = std::max<float>(h1, h2);
+    _collisionCache.StoreHeight(x, y, z, maxSearchDist, phasemask, vmap ? 1 : 0, height);
+    return height;
 }
 
 bool Map::IsInWater(uint32 phaseMask, float x, float y, float pZ, float collisionHeight) const
@@ -2611,8 +2763,8 @@ inline void Map::setNGrid(NGridType* grid, uint32 x, uint32 y)
 
 void Map::SendObjectUpdates()
 {
-    UpdateDataMapType update_players;
-    UpdatePlayerSet player_set;
+    UpdateDataMapType update_players(Acore::GetTickArenaResource());
+    UpdatePlayerSet player_set(Acore::GetTickArenaResource());
 
     while (!_updateObjects.empty())
     {
@@ -3346,6 +3498,42 @@ void Map::UpdateIteratorBack(Player* player)
         m_mapRefIter = m_mapRefIter->nocheck_prev();
 }
 
+void Map::AddToRespawnQueue(WorldObject* obj, time_t respawnTime)
+{
+    ASSERT(obj->GetMap() == this);
+
+    obj->SetRespawnDormant(true);
+    _respawnQueue.push({ respawnTime, obj->GetGUID() });
+}
+
+uint32 Map::ProcessRespawnQueue()
+{
+    time_t now = GameTime::GetGameTime().count();
+    uint32 wakeUps = 0;
+
+    while (!_respawnQueue.empty() && _respawnQueue.top().RespawnTime <= now)
+    {
+        ObjectGuid guid = _respawnQueue.top().Guid;
+        _respawnQueue.pop();
+
+        WorldObject* obj = nullptr;
+        if (guid.IsGameObject())
+            obj = GetGameObject(guid);
+        else
+            obj = GetCreature(guid);
+
+        // removed from the map or woken up earlier
+        if (!obj || !obj->IsRespawnDormant())
+            continue;
+
+        // the next grid update of the object respawns it, or queues it again if its respawn time was moved
+        obj->SetRespawnDormant(false);
+        ++wakeUps;
+    }
+
+    return wakeUps;
+}
+
 void Map::SaveCreatureRespawnTime(ObjectGuid::LowType spawnId, time_t& respawnTime)
 {
     if (!respawnTime)
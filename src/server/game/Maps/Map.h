@@ -26,6 +26,7 @@
 #include "GameObjectModel.h"
 #include "GridDefines.h"
 #include "GridRefMgr.h"
+#include "MapCollisionCache.h"
 #include "MapRefMgr.h"
 #include "ObjectDefines.h"
 #include "ObjectGuid.h"
@@ -38,6 +39,7 @@
 #include <list>
 #include <memory>
 #include <mutex>
+#include <queue>
 #include <shared_mutex>
 
 class Unit;
@@ -357,6 +359,8 @@ public:
     void CreatureRelocation(Creature* creature, float x, float y, float z, float o);
     void GameObjectRelocation(GameObject* go, float x, float y, float z, float o);
     void DynamicObjectRelocation(DynamicObject* go, float x, float y, float z, float o);
+    // Relocation of a transport passenger by its transport, only a cell change takes the full relocation path
+    void TransportPassengerRelocation(WorldObject* passenger, float x, float y, float z, float o, bool updateVisibility);
 
     template<class T, class CONTAINER> void Visit(const Cell& cell, TypeContainerVisitor<T, CONTAINER>& visitor);
 
@@ -557,8 +561,10 @@ public:
     bool CanReachPositionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true, bool failOnSlopes = true) const;
     bool CheckCollisionAndGetValidCoords(WorldObject const* source, float startX, float startY, float startZ, float &destX, float &destY, float &destZ, bool failOnCollision = true) const;
     void Balance() { _dynamicTree.balance(); }
-    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); }
-    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); }
+    void RemoveGameObjectModel(const GameObjectModel& model) { _dynamicTree.remove(model); InvalidateCollisionCache(model); }
+    void InsertGameObjectModel(const GameObjectModel& model) { _dynamicTree.insert(model); InvalidateCollisionCache(model); }
+    void InvalidateCollisionCache() { _collisionCache.Invalidate(); }
+    void InvalidateCollisionCache(GameObjectModel const& model);
     [[nodiscard]] bool ContainsGameObjectModel(const GameObjectModel& model) const { return _dynamicTree.contains(model);}
     [[nodiscard]] DynamicMapTree const& GetDynamicMapTree() const { return _dynamicTree; }
     bool GetObjectHitPos(uint32 phasemask, float x1, float y1, float z1, float x2, float y2, float z2, float& rx, float& ry, float& rz, float modifyDist);
@@ -598,6 +604,13 @@ public:
 
     TaskScheduler _creatureRespawnScheduler;
 
+    /*
+        RESPAWN QUEUE
+    */
+    // Takes a dead creature or despawned game object out of the grid updates until respawnTime
+    void AddToRespawnQueue(WorldObject* obj, time_t respawnTime);
+    [[nodiscard]] std::size_t GetRespawnQueueSize() const { return _respawnQueue.size(); }
+
     void ScheduleCreatureRespawn(ObjectGuid /*creatureGuid*/, Milliseconds /*respawnTimer*/);
 
     void LoadCorpseData();
@@ -666,6 +679,8 @@ private:
     // Load MMap Data
     void LoadMMap(int gx, int gy);
 
+    [[nodiscard]] bool CalculateLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phasemask, LineOfSightChecks checks, VMAP::ModelIgnoreFlags ignoreFlags) const;
+
     template<class T> void InitializeObject(T* obj);
     void AddCreatureToMoveList(Creature* c);
     void RemoveCreatureFromMoveList(Creature* c);
@@ -711,6 +726,7 @@ protected:
     uint32 m_unloadTimer;
     float m_VisibleDistance;
     DynamicMapTree _dynamicTree;
+    mutable MapCollisionCache _collisionCache;
     time_t _instanceResetPeriod; // pussywizard
 
     MapRefMgr m_mapRefMgr;
@@ -782,6 +798,19 @@ private:
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _creatureRespawnTimes;
     std::unordered_map<ObjectGuid::LowType /*dbGUID*/, time_t> _goRespawnTimes;
 
+    struct RespawnQueueEntry
+    {
+        time_t RespawnTime;
+        ObjectGuid Guid;
+
+        bool operator>(RespawnQueueEntry const& right) const { return RespawnTime > right.RespawnTime; }
+    };
+
+    uint32 ProcessRespawnQueue();
+
+    // min-heap on the respawn time, entries of removed or already woken objects are dropped when due
+    std::priority_queue<RespawnQueueEntry, std::vector<RespawnQueueEntry>, std::greater<RespawnQueueEntry>> _respawnQueue;
+
     ZoneDynamicInfoMap _zoneDynamicInfo;
     uint32 _defaultLight;
 
@@ -0,0 +1,197 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "MapCollisionCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    int32 Quantize(float value)
+    {
+        return int32(std::lround(value / MapCollisionCache::COLLISION_CACHE_QUANTUM));
+    }
+
+    // queries matching a cached key may be up to half a quantum away from the one that was stored
+    constexpr float REGION_PADDING = MapCollisionCache::COLLISION_CACHE_QUANTUM;
+}
+
+MapCollisionCache::MapCollisionCache(uint32 size) : _mask(0), _generation(1), _validGeneration(1), _storedInGeneration(false),
+    _dirtyRegions(), _dirtyRegionHead(0), _dirtyRegionCount(0), _hits(0), _misses(0), _invalidations(0)
+{
+    if (!size)
+        return;
+
+    // round up to a power of two so slot selection is a single mask
+    std::size_t capacity = 1;
+    while (capacity < size)
+        capacity <<= 1;
+
+    _lineOfSight.resize(capacity, Entry());
+    _height.resize(capacity, Entry());
+    _mask = capacity - 1;
+}
+
+MapCollisionCache::Key MapCollisionCache::MakeKey(float a, float b, float c, float d, float e, float f, uint32 phaseMask, uint32 flags)
+{
+    return { { Quantize(a), Quantize(b), Quantize(c), Quantize(d), Quantize(e), Quantize(f) }, phaseMask, flags };
+}
+
+std::size_t MapCollisionCache::GetSlot(Key const& key) const
+{
+    // FNV-1a over the key words
+    uint64 hash = 14695981039346656037ULL;
+    for (int32 coord : key.Coords)
+        hash = (hash ^ uint32(coord)) * 1099511628211ULL;
+
+    hash = (hash ^ key.PhaseMask) * 1099511628211ULL;
+    hash = (hash ^ key.Flags) * 1099511628211ULL;
+    return std::size_t(hash ^ (hash >> 32)) & _mask;
+}
+
+bool MapCollisionCache::IsValid(Entry const& entry, Region const& bounds) const
+{
+    // also rejects never written slots, generation 0
+    if (entry.Generation < _validGeneration)
+        return false;
+
+    // walk the regions changed after the entry was stored, newest first
+    for (std::size_t i = 1; i <= _dirtyRegionCount; ++i)
+    {
+        DirtyRegion const& region = _dirtyRegions[(_dirtyRegionHead + DIRTY_REGIONS - i) % DIRTY_REGIONS];
+        if (region.Generation <= entry.Generation)
+            break;
+
+        if (region.Bounds.Intersects(bounds))
+            return false;
+    }
+
+    return true;
+}
+
+bool MapCollisionCache::Find(std::vector<Entry>& table, Key const& key, Region const& bounds, float& value)
+{
+    if (!IsEnabled())
+        return false;
+
+    Entry const& entry = table[GetSlot(key)];
+    if (entry.QueryKey == key && IsValid(entry, bounds))
+    {
+        ++_hits;
+        value = entry.Value;
+        return true;
+    }
+
+    ++_misses;
+    return false;
+}
+
+void MapCollisionCache::Store(std::vector<Entry>& table, Key const& key, float value)
+{
+    if (!IsEnabled())
+        return;
+
+    Entry& entry = table[GetSlot(key)];
+    entry.QueryKey = key;
+    entry.Generation = _generation;
+    entry.Value = value;
+    _storedInGeneration = true;
+}
+
+bool MapCollisionCache::GetLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask, uint32 flags, bool& result)
+{
+    Region const bounds = { std::min(x1, x2), std::min(y1, y2), std::max(x1, x2), std::max(y1, y2) };
+    float value;
+    if (!Find(_lineOfSight, MakeKey(x1, y1, z1, x2, y2, z2, phaseMask, flags), bounds, value))
+        return false;
+
+    result = value != 0.0f;
+    return true;
+}
+
+void MapCollisionCache::StoreLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask, uint32 flags, bool result)
+{
+    Store(_lineOfSight, MakeKey(x1, y1, z1, x2, y2, z2, phaseMask, flags), result ? 1.0f : 0.0f);
+}
+
+bool MapCollisionCache::GetHeight(float x, float y, float z, float maxSearchDist, uint32 phaseMask, uint32 flags, float& result)
+{
+    return Find(_height, MakeKey(x, y, z, maxSearchDist, 0.0f, 0.0f, phaseMask, flags), { x, y, x, y }, result);
+}
+
+void MapCollisionCache::StoreHeight(float x, float y, float z, float maxSearchDist, uint32 phaseMask, uint32 flags, float result)
+{
+    Store(_height, MakeKey(x, y, z, maxSearchDist, 0.0f, 0.0f, phaseMask, flags), result);
+}
+
+void MapCollisionCache::Invalidate()
+{
+    if (!IsEnabled())
+        return;
+
+    ++_invalidations;
+    NextGeneration();
+    _validGeneration = _generation;
+    _dirtyRegionCount = 0;
+}
+
+void MapCollisionCache::InvalidateRegion(float minX, float minY, float maxX, float maxY)
+{
+    if (!IsEnabled())
+        return;
+
+    ++_invalidations;
+    Region const bounds = { minX - REGION_PADDING, minY - REGION_PADDING, maxX + REGION_PADDING, maxY + REGION_PADDING };
+
+    // nothing was stored since the newest region (remove + insert of a moving model), extend it
+    if (!_storedInGeneration && _dirtyRegionCount)
+    {
+        DirtyRegion& newest = _dirtyRegions[(_dirtyRegionHead + DIRTY_REGIONS - 1) % DIRTY_REGIONS];
+        if (newest.Generation == _generation)
+        {
+            newest.Bounds = { std::min(newest.Bounds.MinX, bounds.MinX), std::min(newest.Bounds.MinY, bounds.MinY),
+                std::max(newest.Bounds.MaxX, bounds.MaxX), std::max(newest.Bounds.MaxY, bounds.MaxY) };
+            return;
+        }
+    }
+
+    NextGeneration();
+
+    // the oldest region is forgotten, entries it could have changed must go too
+    if (_dirtyRegionCount == DIRTY_REGIONS)
+        _validGeneration = std::max(_validGeneration, _dirtyRegions[_dirtyRegionHead].Generation);
+    else
+        ++_dirtyRegionCount;
+
+    _dirtyRegions[_dirtyRegionHead] = { bounds, _generation };
+    _dirtyRegionHead = (_dirtyRegionHead + 1) % DIRTY_REGIONS;
+}
+
+void MapCollisionCache::NextGeneration()
+{
+    _storedInGeneration = false;
+
+    // generation 0 marks never written slots, wipe everything once the counter wraps
+    if (++_generation == 0)
+    {
+        std::fill(_lineOfSight.begin(), _lineOfSight.end(), Entry());
+        std::fill(_height.begin(), _height.end(), Entry());
+        _generation = 1;
+        _validGeneration = 1;
+        _dirtyRegionCount = 0;
+    }
+}
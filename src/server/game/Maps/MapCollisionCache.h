@@ -0,0 +1,118 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _MAP_COLLISION_CACHE_H
+#define _MAP_COLLISION_CACHE_H
+
+#include "Define.h"
+#include <array>
+#include <vector>
+
+/**
+ * @brief Bounded, direct-mapped cache for the results of line of sight and height queries of a single map.
+ *
+ * Query coordinates are quantized to COLLISION_CACHE_QUANTUM yards, so repeated queries between (almost)
+ * the same points inside the same tick are answered without walking the vmap BIH or the dynamic tree.
+ * Grid load/unload must call Invalidate(), which drops all cached entries in O(1). Changes of game object
+ * models (insert/remove, transport movement, door state) call InvalidateRegion() with the 2D bounds of the
+ * model, which only drops the entries whose query touched that area: the last DIRTY_REGIONS regions are
+ * remembered and checked on lookup, entries older than the oldest remembered region are dropped.
+ *
+ * Like the rest of the map state, the cache is only accessed from the thread updating the map.
+ */
+class MapCollisionCache
+{
+public:
+    static constexpr float COLLISION_CACHE_QUANTUM = 0.125f;
+    static constexpr std::size_t DIRTY_REGIONS = 64;
+
+    explicit MapCollisionCache(uint32 size);
+
+    [[nodiscard]] bool IsEnabled() const { return _mask != 0; }
+
+    bool GetLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask, uint32 flags, bool& result);
+    void StoreLineOfSight(float x1, float y1, float z1, float x2, float y2, float z2, uint32 phaseMask, uint32 flags, bool result);
+
+    bool GetHeight(float x, float y, float z, float maxSearchDist, uint32 phaseMask, uint32 flags, float& result);
+    void StoreHeight(float x, float y, float z, float maxSearchDist, uint32 phaseMask, uint32 flags, float result);
+
+    void Invalidate();
+    void InvalidateRegion(float minX, float minY, float maxX, float maxY);
+
+    [[nodiscard]] uint32 GetHits() const { return _hits; }
+    [[nodiscard]] uint32 GetMisses() const { return _misses; }
+    [[nodiscard]] uint32 GetInvalidations() const { return _invalidations; }
+    void ResetStats() { _hits = _misses = _invalidations = 0; }
+
+private:
+    struct Key
+    {
+        std::array<int32, 6> Coords;
+        uint32 PhaseMask;
+        uint32 Flags;
+
+        bool operator==(Key const& right) const { return Coords == right.Coords && PhaseMask == right.PhaseMask && Flags == right.Flags; }
+    };
+
+    struct Entry
+    {
+        Key QueryKey;
+        uint32 Generation;
+        float Value;
+    };
+
+    struct Region
+    {
+        float MinX, MinY, MaxX, MaxY;
+
+        [[nodiscard]] bool Intersects(Region const& right) const
+        {
+            return MinX <= right.MaxX && right.MinX <= MaxX && MinY <= right.MaxY && right.MinY <= MaxY;
+        }
+    };
+
+    struct DirtyRegion
+    {
+        Region Bounds;
+        uint32 Generation;
+    };
+
+    static Key MakeKey(float a, float b, float c, float d, float e, float f, uint32 phaseMask, uint32 flags);
+    [[nodiscard]] std::size_t GetSlot(Key const& key) const;
+    [[nodiscard]] bool IsValid(Entry const& entry, Region const& bounds) const;
+    void NextGeneration();
+
+    bool Find(std::vector<Entry>& table, Key const& key, Region const& bounds, float& value);
+    void Store(std::vector<Entry>& table, Key const& key, float value);
+
+    std::vector<Entry> _lineOfSight;
+    std::vector<Entry> _height;
+    std::size_t _mask;
+    uint32 _generation;
+    uint32 _validGeneration;                            // entries of older generations are invalid
+    bool _storedInGeneration;                           // false while the newest region can still be extended
+
+    std::array<DirtyRegion, DIRTY_REGIONS> _dirtyRegions; // ring buffer, ordered by generation
+    std::size_t _dirtyRegionHead;                       // slot of the next region
+    std::size_t _dirtyRegionCount;
+
+    uint32 _hits;
+    uint32 _misses;
+    uint32 _invalidations;
+};
+
+#endif // _MAP_COLLISION_CACHE_H
@@ -16,6 +16,7 @@
  */
 
 #include "MapUpdater.h"
+#include "CharacterCache.h"
 #include "DatabaseEnv.h"
 #include "LFGMgr.h"
 #include "Map.h"
@@ -144,6 +145,7 @@ void MapUpdater::WorkerThread()
     LoginDatabase.WarnAboutSyncQueries(true);
     CharacterDatabase.WarnAboutSyncQueries(true);
     WorldDatabase.WarnAboutSyncQueries(true);
+    sCharacterCache->WarnAboutSyncLoads(true);
 
     while (1)
     {
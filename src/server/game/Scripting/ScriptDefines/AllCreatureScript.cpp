@@ -23,47 +23,32 @@ void ScriptMgr::OnCreatureAddWorld(Creature* creature)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-    {
-        script->OnCreatureAddWorld(creature);
-    });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_CREATURE_ADD_WORLD, script->OnCreatureAddWorld(creature));
 }
 
 void ScriptMgr::OnCreatureRemoveWorld(Creature* creature)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-    {
-        script->OnCreatureRemoveWorld(creature);
-    });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_CREATURE_REMOVE_WORLD, script->OnCreatureRemoveWorld(creature));
 }
 
 void ScriptMgr::OnCreatureSaveToDB(Creature* creature)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-    {
-        script->OnCreatureSaveToDB(creature);
-    });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_CREATURE_SAVE_TO_DB, script->OnCreatureSaveToDB(creature));
 }
 
 void ScriptMgr::OnBeforeCreatureSelectLevel(const CreatureTemplate* cinfo, Creature* creature, uint8& level)
 {
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-    {
-        script->OnBeforeCreatureSelectLevel(cinfo, creature, level);
-    });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_BEFORE_CREATURE_SELECT_LEVEL, script->OnBeforeCreatureSelectLevel(cinfo, creature, level));
 
 }
 
 void ScriptMgr::Creature_SelectLevel(const CreatureTemplate* cinfo, Creature* creature)
 {
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-    {
-        script->Creature_SelectLevel(cinfo, creature);
-    });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_CREATURE_SELECT_LEVEL, script->Creature_SelectLevel(cinfo, creature));
 }
 
 //bool ScriptMgr::CanCreatureSendListInventory(Player* player, Creature* creature, uint32 vendorEntry)
@@ -79,10 +64,15 @@ void ScriptMgr::Creature_SelectLevel(const CreatureTemplate* cinfo, Creature* cr
 //    return true;
 //}
 
-AllCreatureScript::AllCreatureScript(const char* name) :
-    ScriptObject(name)
+AllCreatureScript::AllCreatureScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name, ALLCREATUREHOOK_END)
 {
-    ScriptRegistry<AllCreatureScript>::AddScript(this);
+    // If empty - enable all available hooks.
+    if (enabledHooks.empty())
+        for (uint16 i = 0; i < ALLCREATUREHOOK_END; ++i)
+            enabledHooks.emplace_back(i);
+
+    ScriptRegistry<AllCreatureScript>::AddScript(this, std::move(enabledHooks));
 }
 
 template class AC_GAME_API ScriptRegistry<AllCreatureScript>;
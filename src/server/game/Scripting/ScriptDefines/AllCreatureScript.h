@@ -19,11 +19,30 @@
 #define SCRIPT_OBJECT_ALL_CREATURE_SCRIPT_H_
 
 #include "ScriptObject.h"
+#include <vector>
+
+enum AllCreatureHook
+{
+    ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE,
+    ALLCREATUREHOOK_ON_BEFORE_CREATURE_SELECT_LEVEL,
+    ALLCREATUREHOOK_ON_CREATURE_SELECT_LEVEL,
+    ALLCREATUREHOOK_ON_CREATURE_ADD_WORLD,
+    ALLCREATUREHOOK_ON_CREATURE_REMOVE_WORLD,
+    ALLCREATUREHOOK_ON_CREATURE_SAVE_TO_DB,
+    ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_HELLO,
+    ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT,
+    ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT_CODE,
+    ALLCREATUREHOOK_CAN_CREATURE_QUEST_ACCEPT,
+    ALLCREATUREHOOK_CAN_CREATURE_QUEST_REWARD,
+    ALLCREATUREHOOK_GET_CREATURE_AI,
+    ALLCREATUREHOOK_ON_FFA_PVP_STATE_UPDATE,
+    ALLCREATUREHOOK_END
+};
 
 class AllCreatureScript : public ScriptObject
 {
 protected:
-    AllCreatureScript(const char* name);
+    AllCreatureScript(const char* name, std::vector<uint16> enabledHooks = std::vector<uint16>());
 
 public:
     // Called from End of Creature Update.
@@ -23,36 +23,32 @@ void ScriptMgr::OnGameObjectAddWorld(GameObject* go)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectAddWorld(go);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_ADD_WORLD, script->OnGameObjectAddWorld(go));
 }
 
 void ScriptMgr::OnGameObjectRemoveWorld(GameObject* go)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectRemoveWorld(go);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_REMOVE_WORLD, script->OnGameObjectRemoveWorld(go));
 }
 
 void ScriptMgr::OnGameObjectSaveToDB(GameObject* go)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectSaveToDB(go);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_SAVE_TO_DB, script->OnGameObjectSaveToDB(go));
 }
 
-AllGameObjectScript::AllGameObjectScript(const char* name) :
-    ScriptObject(name)
+AllGameObjectScript::AllGameObjectScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name, ALLGAMEOBJECTHOOK_END)
 {
-    ScriptRegistry<AllGameObjectScript>::AddScript(this);
+    // If empty - enable all available hooks.
+    if (enabledHooks.empty())
+        for (uint16 i = 0; i < ALLGAMEOBJECTHOOK_END; ++i)
+            enabledHooks.emplace_back(i);
+
+    ScriptRegistry<AllGameObjectScript>::AddScript(this, std::move(enabledHooks));
 }
 
 template class AC_GAME_API ScriptRegistry<AllGameObjectScript>;
@@ -27,7 +27,7 @@ bool ScriptMgr::OnQuestAccept(Player* player, Item* item, Quest const* quest)
     ASSERT(item);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllItemScript>([&](AllItemScript* script)
+    auto ret = IsValidBoolScript<AllItemScript>(ALLITEMHOOK_CAN_ITEM_QUEST_ACCEPT, [&](AllItemScript* script)
     {
         return !script->CanItemQuestAccept(player, item, quest);
     });
@@ -47,7 +47,7 @@ bool ScriptMgr::OnItemUse(Player* player, Item* item, SpellCastTargets const& ta
     ASSERT(player);
     ASSERT(item);
 
-    auto ret = IsValidBoolScript<AllItemScript>([&](AllItemScript* script)
+    auto ret = IsValidBoolScript<AllItemScript>(ALLITEMHOOK_CAN_ITEM_USE, [&](AllItemScript* script)
     {
         return script->CanItemUse(player, item, targets);
     });
@@ -66,7 +66,7 @@ bool ScriptMgr::OnItemExpire(Player* player, ItemTemplate const* proto)
     ASSERT(player);
     ASSERT(proto);
 
-    auto ret = IsValidBoolScript<AllItemScript>([&](AllItemScript* script)
+    auto ret = IsValidBoolScript<AllItemScript>(ALLITEMHOOK_CAN_ITEM_EXPIRE, [&](AllItemScript* script)
     {
         return !script->CanItemExpire(player, proto);
     });
@@ -85,7 +85,7 @@ bool ScriptMgr::OnItemRemove(Player* player, Item* item)
     ASSERT(player);
     ASSERT(item);
 
-    auto ret = IsValidBoolScript<AllItemScript>([&](AllItemScript* script)
+    auto ret = IsValidBoolScript<AllItemScript>(ALLITEMHOOK_CAN_ITEM_REMOVE, [&](AllItemScript* script)
     {
         return !script->CanItemRemove(player, item);
     });
@@ -115,10 +115,7 @@ void ScriptMgr::OnGossipSelect(Player* player, Item* item, uint32 sender, uint32
     ASSERT(player);
     ASSERT(item);
 
-    ExecuteScript<AllItemScript>([&](AllItemScript* script)
-    {
-        script->OnItemGossipSelect(player, item, sender, action);
-    });
+    CALL_ENABLED_HOOKS(AllItemScript, ALLITEMHOOK_ON_ITEM_GOSSIP_SELECT, script->OnItemGossipSelect(player, item, sender, action));
 
     if (auto tempScript = ScriptRegistry<ItemScript>::GetScriptById(item->GetScriptId()))
     {
@@ -131,10 +128,7 @@ void ScriptMgr::OnGossipSelectCode(Player* player, Item* item, uint32 sender, ui
     ASSERT(player);
     ASSERT(item);
 
-    ExecuteScript<AllItemScript>([&](AllItemScript* script)
-    {
-        script->OnItemGossipSelectCode(player, item, sender, action, code);
-    });
+    CALL_ENABLED_HOOKS(AllItemScript, ALLITEMHOOK_ON_ITEM_GOSSIP_SELECT_CODE, script->OnItemGossipSelectCode(player, item, sender, action, code));
 
     if (auto tempScript = ScriptRegistry<ItemScript>::GetScriptById(item->GetScriptId()))
     {
@@ -142,10 +136,15 @@ void ScriptMgr::OnGossipSelectCode(Player* player, Item* item, uint32 sender, ui
     }
 }
 
-AllItemScript::AllItemScript(const char* name) :
-    ScriptObject(name)
+AllItemScript::AllItemScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name, ALLITEMHOOK_END)
 {
-    ScriptRegistry<AllItemScript>::AddScript(this);
+    // If empty - enable all available hooks.
+    if (enabledHooks.empty())
+        for (uint16 i = 0; i < ALLITEMHOOK_END; ++i)
+            enabledHooks.emplace_back(i);
+
+    ScriptRegistry<AllItemScript>::AddScript(this, std::move(enabledHooks));
 }
 
 ItemScript::ItemScript(const char* name) :
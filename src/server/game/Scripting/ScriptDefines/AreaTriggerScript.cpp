@@ -26,7 +26,7 @@ bool ScriptMgr::OnAreaTrigger(Player* player, AreaTrigger const* trigger)
     ASSERT(player);
     ASSERT(trigger);
 
-    auto ret = IsValidBoolScript<ElunaScript>([&](ElunaScript* script)
+    auto ret = IsValidBoolScript<ElunaScript>(ELUNAHOOK_CAN_AREA_TRIGGER, [&](ElunaScript* script)
     {
         return script->CanAreaTrigger(player, trigger);
     });
@@ -26,7 +26,7 @@ bool ScriptMgr::OnGossipHello(Player* player, Creature* creature)
     ASSERT(player);
     ASSERT(creature);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_HELLO, [&](AllCreatureScript* script)
     {
         return script->CanCreatureGossipHello(player, creature);
     });
@@ -46,7 +46,7 @@ bool ScriptMgr::OnGossipSelect(Player* player, Creature* creature, uint32 sender
     ASSERT(player);
     ASSERT(creature);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT, [&](AllCreatureScript* script)
     {
         return script->CanCreatureGossipSelect(player, creature, sender, action);
     });
@@ -66,7 +66,7 @@ bool ScriptMgr::OnGossipSelectCode(Player* player, Creature* creature, uint32 se
     ASSERT(creature);
     ASSERT(code);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_GOSSIP_SELECT_CODE, [&](AllCreatureScript* script)
     {
         return script->CanCreatureGossipSelectCode(player, creature, sender, action, code);
     });
@@ -86,7 +86,7 @@ bool ScriptMgr::OnQuestAccept(Player* player, Creature* creature, Quest const* q
     ASSERT(creature);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_QUEST_ACCEPT, [&](AllCreatureScript* script)
     {
         return script->CanCreatureQuestAccept(player, creature, quest);
     });
@@ -129,7 +129,7 @@ bool ScriptMgr::OnQuestReward(Player* player, Creature* creature, Quest const* q
     ASSERT(creature);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllCreatureScript>([&](AllCreatureScript* script)
+    auto ret = IsValidBoolScript<AllCreatureScript>(ALLCREATUREHOOK_CAN_CREATURE_QUEST_REWARD, [&](AllCreatureScript* script)
     {
         return script->CanCreatureQuestReward(player, creature, quest, opt);
     });
@@ -157,7 +157,7 @@ CreatureAI* ScriptMgr::GetCreatureAI(Creature* creature)
 {
     ASSERT(creature);
 
-    auto retAI = GetReturnAIScript<AllCreatureScript, CreatureAI>([creature](AllCreatureScript* script)
+    auto retAI = GetReturnAIScript<AllCreatureScript, CreatureAI>(ALLCREATUREHOOK_GET_CREATURE_AI, [creature](AllCreatureScript* script)
     {
         return script->GetCreatureAI(creature);
     });
@@ -174,20 +174,14 @@ CreatureAI* ScriptMgr::GetCreatureAI(Creature* creature)
 //Fires whenever the UNIT_BYTE2_FLAG_FFA_PVP bit is Changed on the player
 void ScriptMgr::OnFfaPvpStateUpdate(Creature* creature, bool InPvp)
 {
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-        {
-            script->OnFfaPvpStateUpdate(creature, InPvp);
-        });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_FFA_PVP_STATE_UPDATE, script->OnFfaPvpStateUpdate(creature, InPvp));
 }
 
 void ScriptMgr::OnCreatureUpdate(Creature* creature, uint32 diff)
 {
     ASSERT(creature);
 
-    ExecuteScript<AllCreatureScript>([&](AllCreatureScript* script)
-    {
-        script->OnAllCreatureUpdate(creature, diff);
-    });
+    CALL_ENABLED_HOOKS(AllCreatureScript, ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE, script->OnAllCreatureUpdate(creature, diff));
 
     if (auto tempScript = ScriptRegistry<CreatureScript>::GetScriptById(creature->GetScriptId()))
     {
@@ -195,6 +189,14 @@ void ScriptMgr::OnCreatureUpdate(Creature* creature, uint32 diff)
     }
 }
 
+bool ScriptMgr::HasCreatureUpdateHooks(Creature const* creature)
+{
+    ASSERT(creature);
+
+    return !ScriptRegistry<AllCreatureScript>::EnabledHooks[ALLCREATUREHOOK_ON_ALL_CREATURE_UPDATE].empty() ||
+        ScriptRegistry<CreatureScript>::GetScriptById(creature->GetScriptId());
+}
+
 CreatureScript::CreatureScript(const char* name)
     : ScriptObject(name)
 {
@@ -18,9 +18,15 @@
 #include "ElunaScript.h"
 #include "ScriptMgr.h"
 
-ElunaScript::ElunaScript(const char* name) : ScriptObject(name)
+ElunaScript::ElunaScript(const char* name, std::vector<uint16> enabledHooks)
+    : ScriptObject(name, ELUNAHOOK_END)
 {
-    ScriptRegistry<ElunaScript>::AddScript(this);
+    // If empty - enable all available hooks.
+    if (enabledHooks.empty())
+        for (uint16 i = 0; i < ELUNAHOOK_END; ++i)
+            enabledHooks.emplace_back(i);
+
+    ScriptRegistry<ElunaScript>::AddScript(this, std::move(enabledHooks));
 }
 
 template class AC_GAME_API ScriptRegistry<ElunaScript>;
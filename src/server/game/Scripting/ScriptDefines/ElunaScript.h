@@ -19,11 +19,19 @@
 #define SCRIPT_OBJECT_ELUNA_SCRIPT_H_
 
 #include "ScriptObject.h"
+#include <vector>
+
+enum ElunaHook
+{
+    ELUNAHOOK_ON_WEATHER_CHANGE,
+    ELUNAHOOK_CAN_AREA_TRIGGER,
+    ELUNAHOOK_END
+};
 
 class ElunaScript : public ScriptObject
 {
 protected:
-    ElunaScript(const char* name);
+    ElunaScript(const char* name, std::vector<uint16> enabledHooks = std::vector<uint16>());
 
 public:
     /**
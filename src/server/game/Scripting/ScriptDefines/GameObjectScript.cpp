@@ -26,7 +26,7 @@ bool ScriptMgr::OnGossipHello(Player* player, GameObject* go)
     ASSERT(player);
     ASSERT(go);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAMEOBJECT_GOSSIP_HELLO, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectGossipHello(player, go);
     });
@@ -46,7 +46,7 @@ bool ScriptMgr::OnGossipSelect(Player* player, GameObject* go, uint32 sender, ui
     ASSERT(player);
     ASSERT(go);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAMEOBJECT_GOSSIP_SELECT, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectGossipSelect(player, go, sender, action);
     });
@@ -66,7 +66,7 @@ bool ScriptMgr::OnGossipSelectCode(Player* player, GameObject* go, uint32 sender
     ASSERT(go);
     ASSERT(code);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAMEOBJECT_GOSSIP_SELECT_CODE, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectGossipSelectCode(player, go, sender, action, code);
     });
@@ -86,7 +86,7 @@ bool ScriptMgr::OnQuestAccept(Player* player, GameObject* go, Quest const* quest
     ASSERT(go);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAMEOBJECT_QUEST_ACCEPT, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectQuestAccept(player, go, quest);
     });
@@ -107,7 +107,7 @@ bool ScriptMgr::OnQuestReward(Player* player, GameObject* go, Quest const* quest
     ASSERT(go);
     ASSERT(quest);
 
-    auto ret = IsValidBoolScript<AllGameObjectScript>([&](AllGameObjectScript* script)
+    auto ret = IsValidBoolScript<AllGameObjectScript>(ALLGAMEOBJECTHOOK_CAN_GAMEOBJECT_QUEST_REWARD, [&](AllGameObjectScript* script)
     {
         return script->CanGameObjectQuestReward(player, go, quest, opt);
     });
@@ -135,10 +135,7 @@ void ScriptMgr::OnGameObjectDestroyed(GameObject* go, Player* player)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectDestroyed(go, player);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_DESTROYED, script->OnGameObjectDestroyed(go, player));
 
     if (auto tempScript = ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId()))
     {
@@ -150,10 +147,7 @@ void ScriptMgr::OnGameObjectDamaged(GameObject* go, Player* player)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectDamaged(go, player);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_DAMAGED, script->OnGameObjectDamaged(go, player));
 
     if (auto tempScript = ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId()))
     {
@@ -165,10 +159,7 @@ void ScriptMgr::OnGameObjectModifyHealth(GameObject* go, Unit* attackerOrHealer,
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectModifyHealth(go, attackerOrHealer, change, spellInfo);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_MODIFY_HEALTH, script->OnGameObjectModifyHealth(go, attackerOrHealer, change, spellInfo));
 
     if (auto tempScript = ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId()))
     {
@@ -180,10 +171,7 @@ void ScriptMgr::OnGameObjectLootStateChanged(GameObject* go, uint32 state, Unit*
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectLootStateChanged(go, state, unit);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_LOOT_STATE_CHANGED, script->OnGameObjectLootStateChanged(go, state, unit));
 
     if (auto tempScript = ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId()))
     {
@@ -195,10 +183,7 @@ void ScriptMgr::OnGameObjectStateChanged(GameObject* go, uint32 state)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectStateChanged(go, state);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_STATE_CHANGED, script->OnGameObjectStateChanged(go, state));
 
     if (auto tempScript = ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId()))
     {
@@ -210,10 +195,7 @@ void ScriptMgr::OnGameObjectUpdate(GameObject* go, uint32 diff)
 {
     ASSERT(go);
 
-    ExecuteScript<AllGameObjectScript>([&](AllGameObjectScript* script)
-    {
-        script->OnGameObjectUpdate(go, diff);
-    });
+    CALL_ENABLED_HOOKS(AllGameObjectScript, ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_UPDATE, script->OnGameObjectUpdate(go, diff));
 
     if (auto tempScript = ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId()))
     {
@@ -221,11 +203,19 @@ void ScriptMgr::OnGameObjectUpdate(GameObject* go, uint32 diff)
     }
 }
 
+bool ScriptMgr::HasGameObjectUpdateHooks(GameObject const* go)
+{
+    ASSERT(go);
+
+    return !ScriptRegistry<AllGameObjectScript>::EnabledHooks[ALLGAMEOBJECTHOOK_ON_GAMEOBJECT_UPDATE].empty() ||
+        ScriptRegistry<GameObjectScript>::GetScriptById(go->GetScriptId());
+}
+
 GameObjectAI* ScriptMgr::GetGameObjectAI(GameObject* go)
 {
     ASSERT(go);
 
-    auto retAI = GetReturnAIScript<AllGameObjectScript, GameObjectAI>([go](AllGameObjectScript* script)
+    auto retAI = GetReturnAIScript<AllGameObjectScript, GameObjectAI>(ALLGAMEOBJECTHOOK_GET_GAMEOBJECT_AI, [go](AllGameObjectScript* script)
     {
         return script->GetGameObjectAI(go);
     });
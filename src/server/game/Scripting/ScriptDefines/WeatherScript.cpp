@@ -24,10 +24,7 @@ void ScriptMgr::OnWeatherChange(Weather* weather, WeatherState state, float grad
 {
     ASSERT(weather);
 
-    ExecuteScript<ElunaScript>([&](ElunaScript* script)
-    {
-        script->OnWeatherChange(weather, state, grade);
-    });
+    CALL_ENABLED_HOOKS(ElunaScript, ELUNAHOOK_ON_WEATHER_CHANGE, script->OnWeatherChange(weather, state, grade));
 
     if (auto tempScript = ScriptRegistry<WeatherScript>::GetScriptById(weather->GetScriptId()))
     {
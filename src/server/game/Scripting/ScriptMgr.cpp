@@ -36,6 +36,10 @@ namespace
         }
 
         ScriptRegistry<T>::ScriptPointerList.clear();
+
+        // the hook lists point to the scripts deleted above
+        for (auto& hookScripts : ScriptRegistry<T>::EnabledHooks)
+            hookScripts.clear();
     }
 }
 
@@ -80,12 +84,17 @@ void ScriptMgr::Initialize()
 
     ScriptRegistry<AccountScript>::InitEnabledHooksIfNeeded(ACCOUNTHOOK_END);
     ScriptRegistry<AchievementScript>::InitEnabledHooksIfNeeded(ACHIEVEMENTHOOK_END);
+    ScriptRegistry<AllCreatureScript>::InitEnabledHooksIfNeeded(ALLCREATUREHOOK_END);
+    ScriptRegistry<AllGameObjectScript>::InitEnabledHooksIfNeeded(ALLGAMEOBJECTHOOK_END);
+    ScriptRegistry<AllItemScript>::InitEnabledHooksIfNeeded(ALLITEMHOOK_END);
+    ScriptRegistry<AllMapScript>::InitEnabledHooksIfNeeded(ALLMAPHOOK_END);
     ScriptRegistry<ArenaScript>::InitEnabledHooksIfNeeded(ARENAHOOK_END);
     ScriptRegistry<ArenaTeamScript>::InitEnabledHooksIfNeeded(ARENATEAMHOOK_END);
     ScriptRegistry<AuctionHouseScript>::InitEnabledHooksIfNeeded(AUCTIONHOUSEHOOK_END);
     ScriptRegistry<BGScript>::InitEnabledHooksIfNeeded(ALLBATTLEGROUNDHOOK_END);
     ScriptRegistry<CommandSC>::InitEnabledHooksIfNeeded(ALLCOMMANDHOOK_END);
     ScriptRegistry<DatabaseScript>::InitEnabledHooksIfNeeded(DATABASEHOOK_END);
+    ScriptRegistry<ElunaScript>::InitEnabledHooksIfNeeded(ELUNAHOOK_END);
     ScriptRegistry<FormulaScript>::InitEnabledHooksIfNeeded(FORMULAHOOK_END);
     ScriptRegistry<GameEventScript>::InitEnabledHooksIfNeeded(GAMEEVENTHOOK_END);
     ScriptRegistry<GlobalScript>::InitEnabledHooksIfNeeded(GLOBALHOOK_END);
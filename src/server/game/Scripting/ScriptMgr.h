@@ -219,6 +219,7 @@ public: /* CreatureScript */
     uint32 GetDialogStatus(Player* player, Creature* creature);
     CreatureAI* GetCreatureAI(Creature* creature);
     void OnCreatureUpdate(Creature* creature, uint32 diff);
+    bool HasCreatureUpdateHooks(Creature const* creature);
     void OnCreatureAddWorld(Creature* creature);
     void OnCreatureRemoveWorld(Creature* creature);
     void OnFfaPvpStateUpdate(Creature* creature, bool InPvp);
@@ -236,6 +237,7 @@ public: /* GameObjectScript */
     void OnGameObjectLootStateChanged(GameObject* go, uint32 state, Unit* unit);
     void OnGameObjectStateChanged(GameObject* go, uint32 state);
     void OnGameObjectUpdate(GameObject* go, uint32 diff);
+    bool HasGameObjectUpdateHooks(GameObject const* go);
     GameObjectAI* GetGameObjectAI(GameObject* go);
     void OnGameObjectAddWorld(GameObject* go);
     void OnGameObjectRemoveWorld(GameObject* go);
@@ -20,13 +20,13 @@
 
 #include "ScriptMgr.h"
 
-template<typename ScriptName>
-inline Optional<bool> IsValidBoolScript(std::function<bool(ScriptName*)> executeHook)
+template<typename ScriptName, typename TCallable>
+inline Optional<bool> IsValidBoolScript(uint16 hookType, TCallable&& executeHook)
 {
-    if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
+    if (ScriptRegistry<ScriptName>::EnabledHooks[hookType].empty())
         return {};
 
-    for (auto const& [scriptID, script] : ScriptRegistry<ScriptName>::ScriptPointerList)
+    for (ScriptName* script : ScriptRegistry<ScriptName>::EnabledHooks[hookType])
     {
         if (executeHook(script))
             return true;
@@ -35,13 +35,13 @@ inline Optional<bool> IsValidBoolScript(std::function<bool(ScriptName*)> execute
     return false;
 }
 
-template<typename ScriptName, class T>
-inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
+template<typename ScriptName, class T, typename TCallable>
+inline T* GetReturnAIScript(uint16 hookType, TCallable&& executeHook)
 {
-    if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
+    if (ScriptRegistry<ScriptName>::EnabledHooks[hookType].empty())
         return nullptr;
 
-    for (auto const& [scriptID, script] : ScriptRegistry<ScriptName>::ScriptPointerList)
+    for (ScriptName* script : ScriptRegistry<ScriptName>::EnabledHooks[hookType])
     {
         if (T* scriptAI = executeHook(script))
         {
@@ -52,18 +52,6 @@ inline T* GetReturnAIScript(std::function<T*(ScriptName*)> executeHook)
     return nullptr;
 }
 
-template<typename ScriptName>
-inline void ExecuteScript(std::function<void(ScriptName*)> executeHook)
-{
-    if (ScriptRegistry<ScriptName>::ScriptPointerList.empty())
-        return;
-
-    for (auto const& [scriptID, script] : ScriptRegistry<ScriptName>::ScriptPointerList)
-    {
-        executeHook(script);
-    }
-}
-
 inline bool ReturnValidBool(Optional<bool> ret, bool need = false)
 {
     return ret && *ret ? need : !need;
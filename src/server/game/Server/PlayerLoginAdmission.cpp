@@ -0,0 +1,117 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "PlayerLoginAdmission.h"
+#include "Metric.h"
+#include "Timer.h"
+#include "World.h"
+#include <algorithm>
+
+PlayerLoginAdmission* PlayerLoginAdmission::instance()
+{
+    static PlayerLoginAdmission instance;
+    return &instance;
+}
+
+void PlayerLoginAdmission::LoadConfig()
+{
+    _minInFlight = sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT);
+    _maxInFlight = sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT);
+    _targetLatency = sWorld->getIntConfig(CONFIG_PLAYER_LOGIN_ADMISSION_TARGET_LATENCY);
+
+    if (!_window)
+        _window = _minInFlight;
+
+    _window = std::clamp(_window, _minInFlight, std::max(_minInFlight, _maxInFlight));
+}
+
+void PlayerLoginAdmission::Update()
+{
+    // the waiting logins that fit into the free slots may start during this world update
+    uint32 freeSlots = (IsEnabled() && _inFlight < _window) ? _window - _inFlight : 0;
+    if (!IsEnabled())
+        freeSlots = uint32(_waiting.size());
+
+    _admitBound = 0;
+    for (uint64 ticket : _waiting)
+    {
+        if (!freeSlots)
+            break;
+
+        _admitBound = ticket;
+        --freeSlots;
+    }
+
+    METRIC_VALUE("player_login_in_flight", uint64(_inFlight));
+    METRIC_VALUE("player_login_waiting", uint64(_waiting.size()));
+    METRIC_VALUE("player_login_window", uint64(_window));
+}
+
+bool PlayerLoginAdmission::RequestAdmission(uint64& ticket)
+{
+    if (_waiting.empty() && (!IsEnabled() || _inFlight < _window))
+    {
+        ++_inFlight;
+        return true;
+    }
+
+    ticket = ++_nextTicket;
+    _waiting.insert(ticket);
+    return false;
+}
+
+bool PlayerLoginAdmission::PollAdmission(uint64 ticket)
+{
+    if (ticket > _admitBound || !_waiting.erase(ticket))
+        return false;
+
+    ++_inFlight;
+    return true;
+}
+
+void PlayerLoginAdmission::CancelAdmission(uint64 ticket)
+{
+    _waiting.erase(ticket);
+}
+
+void PlayerLoginAdmission::OnLoginLoaded(uint32 latency)
+{
+    if (_inFlight)
+        --_inFlight;
+
+    if (!IsEnabled())
+        return;
+
+    if (latency <= _targetLatency)
+    {
+        _window = std::min(_window + 1, _maxInFlight);
+        return;
+    }
+
+    // all logins admitted before the cut report about the same latency, only react once per latency period
+    if (getMSTimeDiff(_lastDecreaseMSTime, getMSTime()) < _targetLatency)
+        return;
+
+    _lastDecreaseMSTime = getMSTime();
+    _window = std::max(_window - _window / 4, _minInFlight);
+}
+
+void PlayerLoginAdmission::OnLoginAborted()
+{
+    if (_inFlight)
+        --_inFlight;
+}
@@ -0,0 +1,74 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _PLAYER_LOGIN_ADMISSION_H
+#define _PLAYER_LOGIN_ADMISSION_H
+
+#include "Define.h"
+#include <set>
+
+/**
+ * @brief Limits the number of player logins waiting for their character data at the same time.
+ *
+ * A mass reconnect would otherwise put thousands of login query holders into the character database
+ * queue at once and every single login would only finish once most of them are done. Logins over the
+ * limit wait in the world server in arrival order instead.
+ *
+ * The limit adapts to the database: every login loaded within PlayerLogin.Admission.TargetLatency
+ * raises it by one up to PlayerLogin.Admission.MaxInFlight, a slower one cuts it by a quarter (at most
+ * once per target latency) down to PlayerLogin.Admission.MinInFlight.
+ *
+ * Only used from the world thread.
+ */
+class PlayerLoginAdmission
+{
+public:
+    static PlayerLoginAdmission* instance();
+
+    void LoadConfig();
+    void Update();
+
+    /// Returns true if the login may start now, otherwise ticket is set and has to be polled with PollAdmission()
+    bool RequestAdmission(uint64& ticket);
+    bool PollAdmission(uint64 ticket);
+    void CancelAdmission(uint64 ticket);
+
+    /// Releases the slot of an admitted login once its character data was loaded
+    void OnLoginLoaded(uint32 latency);
+    /// Releases the slot of an admitted login that was aborted before its character data was loaded
+    void OnLoginAborted();
+
+private:
+    PlayerLoginAdmission() = default;
+    ~PlayerLoginAdmission() = default;
+
+    [[nodiscard]] bool IsEnabled() const { return _maxInFlight != 0; }
+
+    std::set<uint64> _waiting;
+    uint64 _nextTicket = 0;
+    uint64 _admitBound = 0;
+    uint32 _inFlight = 0;
+    uint32 _window = 0;
+    uint32 _minInFlight = 0;
+    uint32 _maxInFlight = 0;
+    uint32 _targetLatency = 0;
+    uint32 _lastDecreaseMSTime = 0;
+};
+
+#define sPlayerLoginAdmission PlayerLoginAdmission::instance()
+
+#endif // _PLAYER_LOGIN_ADMISSION_H
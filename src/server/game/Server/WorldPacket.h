@@ -32,6 +32,10 @@ public:
     explicit WorldPacket(uint16 opcode, std::size_t res = 200) :
         ByteBuffer(res), m_opcode(opcode) { }
 
+    // heap allocated packets (queued by the sockets and sessions) come from an Acore::ObjectPool shared with EncryptableAndCompressiblePacket
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     WorldPacket(WorldPacket&& packet) noexcept :
         ByteBuffer(std::move(packet)), m_opcode(packet.m_opcode) { }
 
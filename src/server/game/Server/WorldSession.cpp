@@ -22,6 +22,7 @@
 #include "WorldSession.h"
 #include "AccountMgr.h"
 #include "BattlegroundMgr.h"
+#include "CharacterCache.h"
 #include "CharacterPackets.h"
 #include "Common.h"
 #include "DatabaseEnv.h"
@@ -40,9 +41,11 @@
 #include "PacketUtilities.h"
 #include "Pet.h"
 #include "Player.h"
+#include "PlayerLoginAdmission.h"
 #include "QueryHolder.h"
 #include "ScriptMgr.h"
 #include "SocialMgr.h"
+#include "TickArena.h"
 #include "Tokenize.h"
 #include "Transport.h"
 #include "Vehicle.h"
@@ -122,6 +125,9 @@ WorldSession::WorldSession(uint32 id, std::string&& name, std::shared_ptr<WorldS
     _logoutTime(0),
     m_inQueue(false),
     m_playerLoading(false),
+    _loginAdmissionTicket(0),
+    _loginAdmitted(false),
+    _loginStageMSTime(0),
     m_playerLogout(false),
     m_playerRecentlyLogout(false),
     m_playerSave(false),
@@ -163,6 +169,12 @@ WorldSession::~WorldSession()
     if (_player)
         LogoutPlayer(true);
 
+    ///- release the login admission of a login that never finished loading
+    if (!_pendingLoginGuid.IsEmpty())
+        sPlayerLoginAdmission->CancelAdmission(_loginAdmissionTicket);
+    else if (_loginAdmitted)
+        sPlayerLoginAdmission->OnLoginAborted();
+
     /// - If have unclosed socket, close it
     if (m_Socket)
     {
@@ -305,7 +317,7 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
 
     //! Delete packet after processing by default
     bool deletePacket = true;
-    std::vector<WorldPacket*> requeuePackets;
+    std::pmr::vector<WorldPacket*> requeuePackets(Acore::GetTickArenaResource());
     uint32 processedPackets = 0;
     time_t currentTime = GameTime::GetGameTime().count();
 
@@ -505,6 +517,15 @@ bool WorldSession::Update(uint32 diff, PacketFilter& updater)
             LogoutPlayer(true);
         }
 
+        if (!_pendingLoginGuid.IsEmpty() && m_Socket && m_Socket->IsOpen() && sPlayerLoginAdmission->PollAdmission(_loginAdmissionTicket))
+        {
+            METRIC_VALUE("player_login_stage", uint64(GetMSTimeDiffToNow(_loginStageMSTime)), METRIC_TAG("stage", "queue"));
+            _loginAdmitted = true;
+            ObjectGuid playerGuid = _pendingLoginGuid;
+            _pendingLoginGuid.Clear();
+            LoadPlayerLoginData(playerGuid);
+        }
+
         if (m_Socket && !m_Socket->IsOpen())
         {
             if (GetPlayer() && _warden)
@@ -1286,6 +1307,35 @@ SQLQueryHolderCallback& WorldSession::AddQueryHolderCallback(SQLQueryHolderCallb
     return _queryHolderProcessor.AddCallback(std::move(callback));
 }
 
+bool WorldSession::DeferUntilCharacterCacheLoaded(WorldPacket const& packet, ObjectGuid guid)
+{
+    if (sCharacterCache->IsCharacterCacheEntryLoaded(guid))
+        return false;
+
+    // the packet goes through the opcode status and thread checks again, its handler finds the entry cached
+    sCharacterCache->LoadCharacterCacheEntryAsync(guid, GetQueryProcessor(), [this, packet](Optional<CharacterCacheEntry> const& /*entry*/)
+    {
+        WorldPacket* retry = new WorldPacket(packet);
+        retry->rpos(0);
+        QueuePacket(retry);
+    });
+    return true;
+}
+
+bool WorldSession::DeferUntilCharacterCacheLoaded(WorldPacket const& packet, std::string const& name)
+{
+    if (sCharacterCache->IsCharacterCacheEntryLoaded(name))
+        return false;
+
+    sCharacterCache->LoadCharacterCacheEntryAsync(name, GetQueryProcessor(), [this, packet](Optional<CharacterCacheEntry> const& /*entry*/)
+    {
+        WorldPacket* retry = new WorldPacket(packet);
+        retry->rpos(0);
+        QueuePacket(retry);
+    });
+    return true;
+}
+
 void WorldSession::InitWarden(SessionKey const& k, std::string const& os)
 {
     if (os == "Win")
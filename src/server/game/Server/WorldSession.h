@@ -555,6 +555,7 @@ public:                                                 // opcodes handlers
     void HandleCharCreateOpcode(WorldPacket& recvPacket);
     void HandlePlayerLoginOpcode(WorldPacket& recvPacket);
     void HandleCharEnum(PreparedQueryResult result);
+    void LoadPlayerLoginData(ObjectGuid playerGuid);
     void HandlePlayerLoginFromDB(LoginQueryHolder const& holder);
     void HandlePlayerLoginToCharInWorld(Player* pCurrChar);
     void HandlePlayerLoginToCharOutOfWorld(Player* pCurrChar);
@@ -1089,6 +1090,10 @@ public:                                                 // opcodes handlers
     TransactionCallback& AddTransactionCallback(TransactionCallback&& callback);
     SQLQueryHolderCallback& AddQueryHolderCallback(SQLQueryHolderCallback&& callback);
 
+    /// Paged character cache: loads the entry without blocking and queues the packet again once it is known, false if it already is
+    bool DeferUntilCharacterCacheLoaded(WorldPacket const& packet, ObjectGuid guid);
+    bool DeferUntilCharacterCacheLoaded(WorldPacket const& packet, std::string const& name);
+
     void InitializeSession();
     void InitializeSessionCallback(CharacterDatabaseQueryHolder const& realmHolder, uint32 clientCacheVersion);
 
@@ -1171,6 +1176,10 @@ private:
     time_t _logoutTime;
     bool m_inQueue;                                     // session wait in auth.queue
     bool m_playerLoading;                               // code processed in LoginPlayer
+    ObjectGuid _pendingLoginGuid;                       // login waiting for PlayerLoginAdmission
+    uint64 _loginAdmissionTicket;
+    bool _loginAdmitted;                                // login counted by PlayerLoginAdmission until its data is loaded
+    uint32 _loginStageMSTime;
     bool m_playerLogout;                                // code processed in LogoutPlayer
     bool m_playerRecentlyLogout;
     bool m_playerSave;
@@ -23,6 +23,7 @@
 #include "DatabaseEnv.h"
 #include "GameTime.h"
 #include "IPLocation.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "PacketLog.h"
 #include "Random.h"
@@ -91,6 +92,22 @@ void compressBuff(void* dst, uint32* dst_size, void* src, int src_size)
     *dst_size = c_stream.total_out;
 }
 
+static Acore::ObjectPool& GetWorldPacketPool()
+{
+    static Acore::ObjectPool& pool = Acore::ObjectPool::Create("WorldPacket", std::max(sizeof(WorldPacket), sizeof(EncryptableAndCompressiblePacket)));
+    return pool;
+}
+
+void* WorldPacket::operator new(std::size_t size)
+{
+    return GetWorldPacketPool().Allocate(size);
+}
+
+void WorldPacket::operator delete(void* ptr, std::size_t size)
+{
+    GetWorldPacketPool().Deallocate(ptr, size);
+}
+
 void EncryptableAndCompressiblePacket::CompressIfNeeded()
 {
     if (!NeedsCompression())
@@ -25,6 +25,7 @@
 #include "Log.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "Pet.h"
@@ -407,6 +408,22 @@ AuraEffect::~AuraEffect()
     delete m_channelData;
 }
 
+static Acore::ObjectPool& GetAuraEffectPool()
+{
+    static Acore::ObjectPool& pool = Acore::ObjectPool::Create("AuraEffect", sizeof(AuraEffect));
+    return pool;
+}
+
+void* AuraEffect::operator new(std::size_t size)
+{
+    return GetAuraEffectPool().Allocate(size);
+}
+
+void AuraEffect::operator delete(void* ptr, std::size_t size)
+{
+    GetAuraEffectPool().Deallocate(ptr, size);
+}
+
 void AuraEffect::GetTargetList(std::list<Unit*>& targetList) const
 {
     Aura::ApplicationMap const& targetMap = GetBase()->GetApplicationMap();
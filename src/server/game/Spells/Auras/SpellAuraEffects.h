@@ -44,6 +44,10 @@ private:
     ~AuraEffect();
     explicit AuraEffect(Aura* base, uint8 effIndex, int32* baseAmount, Unit* caster);
 public:
+    // allocated from an Acore::ObjectPool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     Unit* GetCaster() const { return GetBase()->GetCaster(); }
     ObjectGuid GetCasterGUID() const { return GetBase()->GetCasterGUID(); }
     Aura* GetBase() const { return m_base; }
@@ -23,6 +23,7 @@
 #include "Log.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "Player.h"
 #include "ScriptMgr.h"
@@ -46,7 +47,7 @@ static constexpr int32 UPDATE_TARGET_MAP_INTERVAL = 500;
 
 AuraApplication::AuraApplication(Unit* target, Unit* caster, Aura* aura, uint8 effMask):
     _target(target), _base(aura), _removeMode(AURA_REMOVE_NONE), _slot(MAX_AURAS),
-    _flags(AFLAG_NONE), _effectsToApply(effMask), _needClientUpdate(false), _disableMask(0)
+    _flags(AFLAG_NONE), _effectsToApply(effMask), _needClientUpdate(false), _disableMask(0), _procTriggerFlags(0)
 {
     ASSERT(GetTarget() && GetBase());
 
@@ -91,6 +92,22 @@ AuraApplication::AuraApplication(Unit* target, Unit* caster, Aura* aura, uint8 e
     _InitFlags(caster, effMask);
 }
 
+static Acore::ObjectPool& GetAuraApplicationPool()
+{
+    static Acore::ObjectPool& pool = Acore::ObjectPool::Create("AuraApplication", sizeof(AuraApplication));
+    return pool;
+}
+
+void* AuraApplication::operator new(std::size_t size)
+{
+    return GetAuraApplicationPool().Allocate(size);
+}
+
+void AuraApplication::operator delete(void* ptr, std::size_t size)
+{
+    GetAuraApplicationPool().Deallocate(ptr, size);
+}
+
 void AuraApplication::_Remove()
 {
     uint8 slot = GetSlot();
@@ -463,6 +480,22 @@ Aura::~Aura()
     _DeleteRemovedApplications();
 }
 
+static Acore::ObjectPool& GetAuraPool()
+{
+    static Acore::ObjectPool& pool = Acore::ObjectPool::Create("Aura", std::max(sizeof(UnitAura), sizeof(DynObjAura)));
+    return pool;
+}
+
+void* Aura::operator new(std::size_t size)
+{
+    return GetAuraPool().Allocate(size);
+}
+
+void Aura::operator delete(void* ptr, std::size_t size)
+{
+    GetAuraPool().Deallocate(ptr, size);
+}
+
 uint32 Aura::GetId() const
 {
     return GetSpellInfo()->Id;
@@ -2247,7 +2280,7 @@ bool Aura::IsProcTriggeredOnEvent(AuraApplication* aurApp, ProcEventInfo& eventI
         return false;
 
     // do checks using conditions table
-    ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, GetId());
+    ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL_PROC, GetId());
     ConditionSourceInfo condInfo = ConditionSourceInfo(eventInfo.GetActor(), eventInfo.GetActionTarget());
     if (!sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
         return false;
@@ -2630,6 +2663,15 @@ void Aura::CallScriptEffectSplitHandlers(AuraEffect* aurEff, AuraApplication con
     }
 }
 
+bool Aura::HasCheckProcScripts() const
+{
+    for (AuraScript* script : m_loadedScripts)
+        if (script->DoCheckProc.size() || script->DoAfterCheckProc.size())
+            return true;
+
+    return false;
+}
+
 bool Aura::CallScriptCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo)
 {
     bool result = true;
@@ -52,12 +52,18 @@ private:
     // xinef: stacking
     uint8 _disableMask;
 
+    uint32 _procTriggerFlags;                      // Proc flags able to trigger the aura in Unit::ProcDamageAndSpellFor
+
     explicit AuraApplication(Unit* target, Unit* caster, Aura* base, uint8 effMask);
     void _Remove();
 private:
     void _InitFlags(Unit* caster, uint8 effMask);
     void _HandleEffect(uint8 effIndex, bool apply);
 public:
+    // allocated from an Acore::ObjectPool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     Unit* GetTarget() const { return _target; }
     Aura* GetBase() const { return _base; }
 
@@ -68,6 +74,7 @@ public:
     bool IsPositive() const { return _flags & AFLAG_POSITIVE; }
     bool IsSelfcasted() const { return _flags & AFLAG_CASTER; }
     uint8 GetEffectsToApply() const { return _effectsToApply; }
+    uint32 GetProcTriggerFlags() const { return _procTriggerFlags; }
 
     void SetRemoveMode(AuraRemoveMode mode) { _removeMode = mode; }
     AuraRemoveMode GetRemoveMode() const {return _removeMode;}
@@ -97,6 +104,10 @@ public:
     void _InitEffects(uint8 effMask, Unit* caster, int32* baseAmount);
     virtual ~Aura();
 
+    // allocated from an Acore::ObjectPool sized for the largest derived class
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     SpellInfo const* GetSpellInfo() const { return m_spellInfo; }
     uint32 GetId() const;
 
@@ -225,6 +236,7 @@ public:
     void CallScriptEffectSplitHandlers(AuraEffect* aurEff, AuraApplication const* aurApp, DamageInfo& dmgInfo, uint32& splitAmount);
 
     // Spell Proc Hooks
+    bool HasCheckProcScripts() const;
     bool CallScriptCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo);
     bool CallScriptAfterCheckProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo, bool isTriggeredAtSpellProcEvent);
     bool CallScriptPrepareProcHandlers(AuraApplication const* aurApp, ProcEventInfo& eventInfo);
@@ -35,6 +35,7 @@
 #include "MapMgr.h"
 #include "ObjectAccessor.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "Pet.h"
 #include "Player.h"
@@ -709,6 +710,22 @@ Spell::~Spell()
     CheckEffectExecuteData();
 }
 
+static Acore::ObjectPool& GetSpellPool()
+{
+    static Acore::ObjectPool& pool = Acore::ObjectPool::Create("Spell", sizeof(Spell));
+    return pool;
+}
+
+void* Spell::operator new(std::size_t size)
+{
+    return GetSpellPool().Allocate(size);
+}
+
+void Spell::operator delete(void* ptr, std::size_t size)
+{
+    GetSpellPool().Deallocate(ptr, size);
+}
+
 void Spell::InitExplicitTargets(SpellCastTargets const& targets)
 {
     m_targets = targets;
@@ -5821,7 +5838,7 @@ SpellCastResult Spell::CheckCast(bool strict)
     {
         ConditionSourceInfo condInfo = ConditionSourceInfo(m_caster);
         condInfo.mConditionTargets[1] = m_targets.GetObjectTarget();
-        ConditionList conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL, m_spellInfo->Id);
+        ConditionList const& conditions = sConditionMgr->GetConditionsForNotGroupedEntry(CONDITION_SOURCE_TYPE_SPELL, m_spellInfo->Id);
         if (!conditions.empty() && !sConditionMgr->IsObjectMeetToConditions(condInfo, conditions))
         {
             // mLastFailedCondition can be nullptr if there was an error processing the condition in Condition::Meets (i.e. wrong data for ConditionTarget or others)
@@ -288,6 +288,10 @@ public:
     Spell(Unit* caster, SpellInfo const* info, TriggerCastFlags triggerFlags, ObjectGuid originalCasterGUID = ObjectGuid::Empty, bool skipCheck = false);
     ~Spell();
 
+    // allocated from an Acore::ObjectPool
+    static void* operator new(std::size_t size);
+    static void operator delete(void* ptr, std::size_t size);
+
     void EffectNULL(SpellEffIndex effIndex);
     void EffectUnused(SpellEffIndex effIndex);
     void EffectDistract(SpellEffIndex effIndex);
@@ -140,6 +140,9 @@ enum WorldBoolConfigs
     CONFIG_ALLOW_TICKETS,
     CONFIG_DELETE_CHARACTER_TICKET_TRACE,
     CONFIG_DBC_ENFORCE_ITEM_ATTRIBUTES,
+    CONFIG_DBC_MEMORY_MAPPED,
+    CONFIG_WORLD_DATABASE_SNAPSHOT,
+    CONFIG_CHARACTER_CACHE_PAGED,
     CONFIG_PRESERVE_CUSTOM_CHANNELS,
     CONFIG_PDUMP_NO_PATHS,
     CONFIG_PDUMP_NO_OVERWRITE,
@@ -263,7 +266,16 @@ enum WorldIntConfigs
     CONFIG_GM_LEVEL_IN_WHO_LIST,
     CONFIG_START_GM_LEVEL,
     CONFIG_GROUP_VISIBILITY,
+    CONFIG_GROUP_MEMBER_STATS_INTERVAL,
+    CONFIG_GROUP_MEMBER_STATS_INTERVAL_OTHER_MAP,
     CONFIG_MAIL_DELIVERY_DELAY,
+    CONFIG_MAIL_EXPIRE_CHUNK_SIZE,
+    CONFIG_MAIL_EXPIRE_MAX_PER_RUN,
+    CONFIG_CHARACTER_CACHE_RESIDENT_DAYS,
+    CONFIG_PLAYER_LOGIN_QUERY_PARTS,
+    CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT,
+    CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT,
+    CONFIG_PLAYER_LOGIN_ADMISSION_TARGET_LATENCY,
     CONFIG_UPTIME_UPDATE,
     CONFIG_SKILL_CHANCE_ORANGE,
     CONFIG_SKILL_CHANCE_YELLOW,
@@ -421,6 +433,7 @@ enum WorldIntConfigs
     CONFIG_WATER_BREATH_TIMER,
     CONFIG_AUCTION_HOUSE_SEARCH_TIMEOUT,
     CONFIG_DAILY_RBG_MIN_LEVEL_AP_REWARD,
+    CONFIG_VMAP_COLLISION_CACHE_SIZE,
     INT_CONFIG_VALUE_COUNT
 };
 
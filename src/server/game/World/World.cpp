@@ -65,11 +65,13 @@
 #include "Metric.h"
 #include "MotdMgr.h"
 #include "ObjectMgr.h"
+#include "ObjectPool.h"
 #include "Opcodes.h"
 #include "OutdoorPvPMgr.h"
 #include "PetitionMgr.h"
 #include "Player.h"
 #include "PlayerDump.h"
+#include "PlayerLoginAdmission.h"
 #include "PoolMgr.h"
 #include "Realm.h"
 #include "ScriptMgr.h"
@@ -78,6 +80,7 @@
 #include "SmartAI.h"
 #include "SpellMgr.h"
 #include "TaskScheduler.h"
+#include "TickArena.h"
 #include "TicketMgr.h"
 #include "Transport.h"
 #include "TransportMgr.h"
@@ -91,6 +94,7 @@
 #include "WaypointMovementGenerator.h"
 #include "WeatherMgr.h"
 #include "WhoListCacheMgr.h"
+#include "WorldDatabaseSnapshot.h"
 #include "WorldPacket.h"
 #include "WorldSession.h"
 #include <boost/asio/ip/address.hpp>
@@ -934,6 +938,8 @@ void World::LoadConfigSettings(bool reload)
     _float_configs[CONFIG_CHANCE_OF_GM_SURVEY] = sConfigMgr->GetOption<float>("GM.TicketSystem.ChanceOfGMSurvey", 50.0f);
 
     _int_configs[CONFIG_GROUP_VISIBILITY]      = sConfigMgr->GetOption<int32>("Visibility.GroupMode", 1);
+    _int_configs[CONFIG_GROUP_MEMBER_STATS_INTERVAL] = sConfigMgr->GetOption<int32>("Group.MemberStats.UpdateInterval", 250);
+    _int_configs[CONFIG_GROUP_MEMBER_STATS_INTERVAL_OTHER_MAP] = sConfigMgr->GetOption<int32>("Group.MemberStats.UpdateIntervalOtherMap", 1000);
 
     _bool_configs[CONFIG_OBJECT_SPARKLES]      = sConfigMgr->GetOption<bool>("Visibility.ObjectSparkles", true);
 
@@ -942,6 +948,13 @@ void World::LoadConfigSettings(bool reload)
     _bool_configs[CONFIG_OBJECT_QUEST_MARKERS] = sConfigMgr->GetOption<bool>("Visibility.ObjectQuestMarkers", true);
 
     _int_configs[CONFIG_MAIL_DELIVERY_DELAY]   = sConfigMgr->GetOption<int32>("MailDeliveryDelay", HOUR);
+    _int_configs[CONFIG_MAIL_EXPIRE_CHUNK_SIZE] = sConfigMgr->GetOption<uint32>("MailExpire.ChunkSize", 1000);
+    if (_int_configs[CONFIG_MAIL_EXPIRE_CHUNK_SIZE] == 0)
+    {
+        LOG_ERROR("server.loading", "MailExpire.ChunkSize (0) must be greater than 0. Set to 1000.");
+        _int_configs[CONFIG_MAIL_EXPIRE_CHUNK_SIZE] = 1000;
+    }
+    _int_configs[CONFIG_MAIL_EXPIRE_MAX_PER_RUN] = sConfigMgr->GetOption<uint32>("MailExpire.MaxPerRun", 0);
 
     _int_configs[CONFIG_UPTIME_UPDATE]         = sConfigMgr->GetOption<int32>("UpdateUptimeInterval", 10);
     if (int32(_int_configs[CONFIG_UPTIME_UPDATE]) <= 0)
@@ -1322,6 +1335,13 @@ void World::LoadConfigSettings(bool reload)
     bool enablePetLOS = sConfigMgr->GetOption<bool>("vmap.petLOS", true);
     _bool_configs[CONFIG_VMAP_BLIZZLIKE_PVP_LOS] = sConfigMgr->GetOption<bool>("vmap.BlizzlikePvPLOS", true);
     _bool_configs[CONFIG_VMAP_BLIZZLIKE_LOS_OPEN_WORLD] = sConfigMgr->GetOption<bool>("vmap.BlizzlikeLOSInOpenWorld", true);
+    int32 collisionCacheSize = sConfigMgr->GetOption<int32>("vmap.CollisionCacheSize", 4096);
+    if (collisionCacheSize < 0 || collisionCacheSize == 1)
+    {
+        LOG_ERROR("server.loading", "vmap.CollisionCacheSize ({}) must be 0 (disabled) or > 1. Using 4096 instead.", collisionCacheSize);
+        collisionCacheSize = 4096;
+    }
+    _int_configs[CONFIG_VMAP_COLLISION_CACHE_SIZE] = uint32(collisionCacheSize);
 
     if (!enableHeight)
         LOG_ERROR("server.loading", "VMap height checking disabled! Creatures movements and other various things WILL be broken! Expect no support.");
@@ -1366,6 +1386,36 @@ void World::LoadConfigSettings(bool reload)
 
     // DBC_ItemAttributes
     _bool_configs[CONFIG_DBC_ENFORCE_ITEM_ATTRIBUTES] = sConfigMgr->GetOption<bool>("DBC.EnforceItemAttributes", true);
+    _bool_configs[CONFIG_DBC_MEMORY_MAPPED] = sConfigMgr->GetOption<bool>("DBC.MemoryMapped", false);
+    _bool_configs[CONFIG_WORLD_DATABASE_SNAPSHOT] = sConfigMgr->GetOption<bool>("WorldDatabase.Snapshot.Enable", false);
+    _bool_configs[CONFIG_CHARACTER_CACHE_PAGED] = sConfigMgr->GetOption<bool>("CharacterCache.Paged", false);
+    _int_configs[CONFIG_CHARACTER_CACHE_RESIDENT_DAYS] = sConfigMgr->GetOption<uint32>("CharacterCache.ResidentDays", 30);
+
+    // Player login pipeline
+    _int_configs[CONFIG_PLAYER_LOGIN_QUERY_PARTS] = sConfigMgr->GetOption<uint32>("PlayerLogin.QueryHolderParts", 4);
+    if (!_int_configs[CONFIG_PLAYER_LOGIN_QUERY_PARTS])
+    {
+        LOG_ERROR("server.loading", "PlayerLogin.QueryHolderParts (0) must be > 0. Using 1 instead.");
+        _int_configs[CONFIG_PLAYER_LOGIN_QUERY_PARTS] = 1;
+    }
+
+    _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT] = sConfigMgr->GetOption<uint32>("PlayerLogin.Admission.MinInFlight", 16);
+    if (!_int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT])
+    {
+        LOG_ERROR("server.loading", "PlayerLogin.Admission.MinInFlight (0) must be > 0. Using 1 instead.");
+        _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT] = 1;
+    }
+
+    _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT] = sConfigMgr->GetOption<uint32>("PlayerLogin.Admission.MaxInFlight", 256);
+    if (_int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT] && _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT] < _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT])
+    {
+        LOG_ERROR("server.loading", "PlayerLogin.Admission.MaxInFlight ({}) must be >= PlayerLogin.Admission.MinInFlight ({}). Using {} instead.",
+            _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT], _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT], _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT]);
+        _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MAX_IN_FLIGHT] = _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_MIN_IN_FLIGHT];
+    }
+
+    _int_configs[CONFIG_PLAYER_LOGIN_ADMISSION_TARGET_LATENCY] = sConfigMgr->GetOption<uint32>("PlayerLogin.Admission.TargetLatency", 1000);
+    sPlayerLoginAdmission->LoadConfig();
 
     // Max instances per hour
     _int_configs[CONFIG_MAX_INSTANCES_PER_HOUR] = sConfigMgr->GetOption<int32>("AccountInstancesPerHour", 5);
@@ -1564,6 +1614,10 @@ void World::SetInitialWorldSettings()
     LoadDBCStores(_dataPath);
     DetectDBCLang();
 
+    ///- Serve the expensive world database loads from the snapshot of the previous start if the world database did not change
+    if (getBoolConfig(CONFIG_WORLD_DATABASE_SNAPSHOT))
+        sWorldDatabaseSnapshot->Initialize(sConfigMgr->GetOption<std::string>("WorldDatabase.Snapshot.File", "world_database.snapshot"));
+
     // Load cinematic cameras
     LoadM2Cameras(_dataPath);
 
@@ -1963,6 +2017,9 @@ void World::SetInitialWorldSettings()
     LOG_INFO("server.loading", "Loading Conditions...");
     sConditionMgr->LoadConditions();
 
+    // all snapshot aware loads are done
+    sWorldDatabaseSnapshot->Finalize();
+
     LOG_INFO("server.loading", "Loading Faction Change Achievement Pairs...");
     sObjectMgr->LoadFactionChangeAchievements();
 
@@ -2000,7 +2057,7 @@ void World::SetInitialWorldSettings()
     ///- Handle outdated emails (delete/return)
     LOG_INFO("server.loading", "Returning Old Mails...");
     LOG_INFO("server.loading", " ");
-    sObjectMgr->ReturnOrDeleteOldMails(false);
+    sObjectMgr->ReturnOrDeleteOldMails();
 
     ///- Load AutoBroadCast
     LOG_INFO("server.loading", "Loading Autobroadcasts...");
@@ -2336,10 +2393,12 @@ void World::Update(uint32 diff)
 
     if (currentGameTime > _mail_expire_check_timer)
     {
-        sObjectMgr->ReturnOrDeleteOldMails(true);
+        sObjectMgr->ReturnOrDeleteOldMails();
         _mail_expire_check_timer = currentGameTime + 6h;
     }
 
+    sPlayerLoginAdmission->Update();
+
     METRIC_TIMER("world_update_time", METRIC_TAG("type", "Update sessions"));
     UpdateSessions(diff);
 
@@ -2488,6 +2547,12 @@ void World::Update(uint32 diff)
         // Stats logger update
         sMetric->Update();
         METRIC_VALUE("update_time_diff", diff);
+
+        Acore::ObjectPool::ForEach([]([[maybe_unused]] Acore::ObjectPool const& pool)
+        {
+            METRIC_VALUE("object_pool_in_use", pool.GetBlocksInUse(), METRIC_TAG("type", pool.GetName()));
+            METRIC_VALUE("object_pool_capacity", pool.GetBlockCapacity(), METRIC_TAG("type", pool.GetName()));
+        });
     }
 }
 
@@ -2794,6 +2859,9 @@ void World::UpdateSessions(uint32 diff)
         }
     }
 
+    // packet handlers of sessions outside of a map use the arena of the world thread
+    Acore::TickArenaScope tickArena;
+
     ///- Then send an update signal to remaining ones
     for (SessionMap::iterator itr = _sessions.begin(), next; itr != _sessions.end(); itr = next)
     {
@@ -3163,6 +3231,7 @@ uint64 World::getWorldState(uint32 index) const
 void World::ProcessQueryCallbacks()
 {
     _queryProcessor.ProcessReadyCallbacks();
+    sObjectMgr->ProcessExpiredMailCallbacks();
 }
 
 void World::RemoveOldCorpses()
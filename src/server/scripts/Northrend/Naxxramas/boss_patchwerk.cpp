@@ -128,8 +128,10 @@ public:
                         std::list<Unit*> meleeRangeTargets;
                         Unit* finalTarget = nullptr;
                         uint8 counter = 0;
-                        auto i = me->GetThreatMgr().GetThreatList().begin();
-                        for (; i != me->GetThreatMgr().GetThreatList().end(); ++i, ++counter)
+                        // copy, adding threat may add references for pet owners
+                        ThreatContainer::StorageType const threatList = me->GetThreatMgr().GetThreatList();
+                        auto i = threatList.begin();
+                        for (; i != threatList.end(); ++i, ++counter)
                         {
                             // Gather all units with melee range
                             Unit* target = (*i)->getTarget();
@@ -25,6 +25,7 @@ DBCDatabaseLoader::DBCDatabaseLoader(char const* tableName, char const* dbcForma
       _dbcFormat(dbcFormatString),
       _sqlIndexPos(0),
       _recordSize(0),
+      _allocatedSize(0),
       _stringPool(stringPool)
 {
     // Get sql index position
@@ -63,6 +64,7 @@ char* DBCDatabaseLoader::Load(uint32& records, char**& indexTable)
     }
 
     std::unique_ptr<char[]> dataTable = std::make_unique<char[]>(result->GetRowCount() * _recordSize);
+    _allocatedSize += result->GetRowCount() * _recordSize;
     std::unique_ptr<uint32[]> newIndexes = std::make_unique<uint32[]>(result->GetRowCount());
     uint32 newRecords = 0;
 
@@ -136,6 +138,7 @@ char* DBCDatabaseLoader::CloneStringToPool(std::string const& str)
 {
     char* buf = new char[str.size() + 1];
     memcpy(buf, str.c_str(), str.size() + 1);
+    _allocatedSize += str.size() + 1;
     _stringPool.push_back(buf);
     return buf;
 }
@@ -28,11 +28,14 @@ struct DBCDatabaseLoader
 
     char* Load(uint32& records, char**& indexTable);
 
+    [[nodiscard]] std::size_t GetAllocatedSize() const { return _allocatedSize; }
+
 private:
     char const* _sqlTableName;
     char const* _dbcFormat;
     int32 _sqlIndexPos;
     uint32 _recordSize;
+    std::size_t _allocatedSize;
     std::vector<char*>& _stringPool;
     char* CloneStringToPool(std::string const& str);
 
@@ -18,13 +18,18 @@
 #include "DBCStore.h"
 #include "DBCDatabaseLoader.h"
 
-DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _indexTableSize(0)
+bool DBCStorageBase::_memoryMapped = false;
+
+DBCStorageBase::DBCStorageBase(char const* fmt) : _fieldCount(0), _fileFormat(fmt), _dataTable(nullptr), _dataTableMapped(false), _indexTableSize(0),
+    _allocatedSize(0), _mappedSize(0)
 {
 }
 
 DBCStorageBase::~DBCStorageBase()
 {
-    delete[] _dataTable;
+    if (!_dataTableMapped)
+        delete[] _dataTable;
+
     for (char* strings : _stringPool)
         delete[] strings;
 }
@@ -33,20 +38,30 @@ bool DBCStorageBase::Load(char const* path, char**& indexTable)
 {
     indexTable = nullptr;
 
-    DBCFileLoader dbc;
+    std::unique_ptr<DBCFileLoader> dbc = std::make_unique<DBCFileLoader>();
 
     // Check if load was sucessful, only then continue
-    if (!dbc.Load(path, _fileFormat))
+    if (!dbc->Load(path, _fileFormat, _memoryMapped))
         return false;
 
-    _fieldCount = dbc.GetCols();
+    _fieldCount = dbc->GetCols();
 
     // load raw non-string data
-    _dataTable = dbc.AutoProduceData(_fileFormat, _indexTableSize, indexTable);
+    _dataTableMapped = dbc->CanUseInPlace(_fileFormat);
+    _dataTable = dbc->AutoProduceData(_fileFormat, _indexTableSize, indexTable);
+    _allocatedSize += _indexTableSize * sizeof(char*);
+    if (!_dataTableMapped)
+        _allocatedSize += dbc->GetNumRows() * DBCFileLoader::GetFormatRecordSize(_fileFormat);
 
     // load strings from dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
+    if (char* stringBlock = dbc->AutoProduceStrings(_fileFormat, _dataTable))
+    {
         _stringPool.push_back(stringBlock);
+        _allocatedSize += dbc->GetStringSize();
+    }
+
+    if (_dataTableMapped || strchr(_fileFormat, FT_STRING))
+        KeepMappedFile(std::move(dbc));
 
     // error in dbc file at loading if nullptr
     return indexTable != nullptr;
@@ -58,20 +73,38 @@ bool DBCStorageBase::LoadStringsFrom(char const* path, char** indexTable)
     if (!indexTable)
         return false;
 
-    DBCFileLoader dbc;
+    std::unique_ptr<DBCFileLoader> dbc = std::make_unique<DBCFileLoader>();
 
     // Check if load was successful, only then continue
-    if (!dbc.Load(path, _fileFormat))
+    if (!dbc->Load(path, _fileFormat, _memoryMapped && strchr(_fileFormat, FT_STRING)))
         return false;
 
     // load strings from another locale dbc data
-    if (char* stringBlock = dbc.AutoProduceStrings(_fileFormat, _dataTable))
+    if (char* stringBlock = dbc->AutoProduceStrings(_fileFormat, _dataTable))
+    {
         _stringPool.push_back(stringBlock);
+        _allocatedSize += dbc->GetStringSize();
+    }
 
+    KeepMappedFile(std::move(dbc));
     return true;
 }
 
 void DBCStorageBase::LoadFromDB(char const* table, char const* format, char**& indexTable)
 {
-    _stringPool.push_back(DBCDatabaseLoader(table, format, _stringPool).Load(_indexTableSize, indexTable));
+    uint32 oldIndexTableSize = _indexTableSize;
+
+    DBCDatabaseLoader loader(table, format, _stringPool);
+    _stringPool.push_back(loader.Load(_indexTableSize, indexTable));
+    _allocatedSize += loader.GetAllocatedSize() + (_indexTableSize - oldIndexTableSize) * sizeof(char*);
+}
+
+void DBCStorageBase::KeepMappedFile(std::unique_ptr<DBCFileLoader>&& dbc)
+{
+    // records or strings of the store point into the mapping, it has to live as long as the store
+    if (!dbc->IsMapped())
+        return;
+
+    _mappedSize += dbc->GetMappedSize();
+    _mappedFiles.push_back(std::move(dbc));
 }
@@ -22,8 +22,11 @@
 #include "DBCStorageIterator.h"
 #include "Errors.h"
 #include <cstring>
+#include <memory>
 #include <vector>
 
+class DBCFileLoader;
+
 /// Interface class for common access
 class DBCStorageBase
 {
@@ -33,6 +36,12 @@ public:
 
     [[nodiscard]] char const* GetFormat() const { return _fileFormat; }
     [[nodiscard]] uint32 GetFieldCount() const { return _fieldCount; }
+    [[nodiscard]] std::size_t GetAllocatedSize() const { return _allocatedSize; }
+    [[nodiscard]] std::size_t GetMappedSize() const { return _mappedSize; }
+
+    /// Map the .dbc files instead of reading them: numeric only stores use the mapped records in place
+    /// and all strings point into the mapped string blocks. Database rows are always loaded into their own overlay.
+    static void SetMemoryMapped(bool enable) { _memoryMapped = enable; }
 
     virtual bool Load(char const* path) = 0;
     virtual bool LoadStringsFrom(char const* path) = 0;
@@ -46,8 +55,17 @@ protected:
     uint32 _fieldCount;
     char const* _fileFormat;
     char* _dataTable;
+    bool _dataTableMapped;
     std::vector<char*> _stringPool;
+    std::vector<std::unique_ptr<DBCFileLoader>> _mappedFiles;
     uint32 _indexTableSize;
+    std::size_t _allocatedSize;
+    std::size_t _mappedSize;
+
+private:
+    void KeepMappedFile(std::unique_ptr<DBCFileLoader>&& dbc);
+
+    static bool _memoryMapped;
 };
 
 template <class T>
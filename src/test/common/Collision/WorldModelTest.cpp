@@ -0,0 +1,70 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "WorldModel.h"
+#include "gtest/gtest.h"
+#include <random>
+
+using namespace VMAP;
+
+TEST(WorldModelTest, IntersectTrianglesMatchesScalar)
+{
+    std::mt19937 rng(12345);
+    std::uniform_real_distribution<float> coord(-50.0f, 50.0f);
+    std::uniform_int_distribution<uint32> triangleCount(1, 11);
+
+    for (uint32 iteration = 0; iteration < 2000; ++iteration)
+    {
+        std::vector<G3D::Vector3> vertices;
+        std::vector<MeshTriangle> triangles;
+        std::vector<uint32> indices;
+        uint32 count = triangleCount(rng);
+        for (uint32 i = 0; i < count; ++i)
+        {
+            for (uint32 v = 0; v < 3; ++v)
+                vertices.emplace_back(coord(rng), coord(rng), coord(rng) * 0.1f);
+
+            triangles.emplace_back(i * 3, i * 3 + 1, i * 3 + 2);
+            indices.push_back(count - 1 - i);
+        }
+
+        // mostly vertical rays, like height and line of sight queries through floors
+        G3D::Ray ray = G3D::Ray::fromOriginAndDirection(G3D::Vector3(coord(rng) * 0.2f, coord(rng) * 0.2f, 20.0f),
+            G3D::Vector3(coord(rng) * 0.01f, coord(rng) * 0.01f, -1.0f).direction());
+
+        for (bool stopAtFirstHit : { false, true })
+        {
+            float scalarDistance = 100.0f;
+            bool scalarHit = false;
+            for (uint32 index : indices)
+            {
+                if (IntersectTriangle(triangles[index], vertices.begin(), ray, scalarDistance))
+                {
+                    scalarHit = true;
+                    if (stopAtFirstHit)
+                        break;
+                }
+            }
+
+            float batchDistance = 100.0f;
+            bool batchHit = IntersectTriangles(triangles.begin(), indices.data(), count, vertices.begin(), ray, batchDistance, stopAtFirstHit);
+
+            EXPECT_EQ(scalarHit, batchHit);
+            EXPECT_EQ(scalarDistance, batchDistance);
+        }
+    }
+}
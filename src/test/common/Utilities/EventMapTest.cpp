@@ -0,0 +1,89 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventMap.h"
+#include "gtest/gtest.h"
+#include <vector>
+
+namespace
+{
+    std::vector<uint32> ExecuteAll(EventMap& events)
+    {
+        std::vector<uint32> executed;
+        while (uint32 eventId = events.ExecuteEvent())
+            executed.push_back(eventId);
+
+        return executed;
+    }
+}
+
+TEST(EventMapTest, ExecutesInTimeAndScheduleOrder)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 300);
+    events.ScheduleEvent(2, 100);
+    events.ScheduleEvent(3, 300);
+    events.ScheduleEvent(4, 200);
+    events.ScheduleEvent(5, 100);
+
+    // more events than the inline capacity
+    for (uint32 eventId = 10; eventId < 30; ++eventId)
+        events.ScheduleEvent(eventId, 1000 + eventId);
+
+    EXPECT_EQ(events.GetNextEventTime(), 100u);
+    EXPECT_EQ(events.GetNextEventTime(3), 300u);
+    EXPECT_EQ(events.GetTimeUntilEvent(4), Milliseconds(200));
+
+    events.Update(300);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ 2, 5, 4, 1, 3 }));
+
+    events.Update(1000);
+    EXPECT_EQ(ExecuteAll(events).size(), 20u);
+    EXPECT_TRUE(events.Empty());
+}
+
+TEST(EventMapTest, DelayedEventsRunAfterEventsOfTheSameTime)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100, 1);
+    events.ScheduleEvent(2, 150);
+    events.ScheduleEvent(3, 100, 1);
+    events.DelayEvents(50, 1);
+
+    events.Update(150);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ 2, 1, 3 }));
+}
+
+TEST(EventMapTest, CancelAndPhases)
+{
+    EventMap events;
+    events.ScheduleEvent(1, 100, 1);
+    events.ScheduleEvent(2, 100, 2);
+    events.ScheduleEvent(3, 100, 0, 2);
+    events.ScheduleEvent(4, 100);
+    events.ScheduleEvent(1, 200, 1);
+    events.CancelEventGroup(2);
+    events.CancelEvent(1);
+
+    // event 3 is only executed in phase 2
+    events.SetPhase(1);
+    events.Update(100);
+    EXPECT_EQ(ExecuteAll(events), std::vector<uint32>({ 4 }));
+    EXPECT_TRUE(events.Empty());
+
+    EXPECT_EQ(events.GetTimeUntilEvent(1), Milliseconds::max());
+}
@@ -0,0 +1,330 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "EventProcessor.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <limits>
+#include <map>
+#include <random>
+#include <vector>
+
+namespace
+{
+    constexpr int CHILD_ID_OFFSET = 1000000;
+
+    using ExecutionLog = std::vector<std::pair<int, uint64>>;
+
+    // events with an id divisible by 5 add a child event when they execute
+    bool HasChild(int id) { return id < CHILD_ID_OFFSET && id % 5 == 0; }
+    uint64 GetChildOffset(int id) { return uint64(id) * 7919 % 300; }
+
+    /// The former std::multimap based EventProcessor, executing in (time, insertion) order
+    class ReferenceProcessor
+    {
+    public:
+        void Add(int id, uint64 time, uint8 group)
+        {
+            _events.emplace(time, id);
+            _groups[id] = group;
+        }
+
+        void Update(uint32 diff)
+        {
+            _time += diff;
+            while (!_events.empty() && _events.begin()->first <= _time)
+            {
+                int id = _events.begin()->second;
+                _events.erase(_events.begin());
+                Log.emplace_back(id, _time);
+                if (HasChild(id))
+                    Add(id + CHILD_ID_OFFSET, _time + GetChildOffset(id), 0);
+            }
+        }
+
+        void CancelGroup(uint8 group)
+        {
+            for (auto itr = _events.begin(); itr != _events.end();)
+            {
+                if (_groups[itr->second] == group)
+                    itr = _events.erase(itr);
+                else
+                    ++itr;
+            }
+        }
+
+        void Modify(int id, uint64 time)
+        {
+            for (auto itr = _events.begin(); itr != _events.end(); ++itr)
+            {
+                if (itr->second != id)
+                    continue;
+
+                _events.erase(itr);
+                _events.emplace(time, id);
+                break;
+            }
+        }
+
+        [[nodiscard]] uint64 GetTime() const { return _time; }
+
+        ExecutionLog Log;
+
+    private:
+        std::multimap<uint64, int> _events;
+        std::map<int, uint8> _groups;
+        uint64 _time = 0;
+    };
+
+    /// The former std::multimap based EventProcessor owning its events, the baseline of the benchmark
+    class MultimapEventProcessor
+    {
+    public:
+        MultimapEventProcessor() = default;
+        MultimapEventProcessor(MultimapEventProcessor const&) = delete;
+        MultimapEventProcessor& operator=(MultimapEventProcessor const&) = delete;
+
+        ~MultimapEventProcessor()
+        {
+            for (auto const& [time, event] : _events)
+                delete event;
+        }
+
+        void AddEvent(BasicEvent* event, uint64 time) { _events.emplace(time, event); }
+        void AddEventAtOffset(std::function<void()>&& function, Milliseconds offset) { AddEvent(new FunctionEvent(std::move(function)), CalculateTime(offset.count())); }
+        [[nodiscard]] uint64 CalculateTime(uint64 offset) const { return _time + offset; }
+
+        void Update(uint32 diff)
+        {
+            _time += diff;
+            while (!_events.empty() && _events.begin()->first <= _time)
+            {
+                BasicEvent* event = _events.begin()->second;
+                _events.erase(_events.begin());
+                if (event->Execute(_time, diff))
+                    delete event;
+            }
+        }
+
+    private:
+        class FunctionEvent : public BasicEvent
+        {
+        public:
+            explicit FunctionEvent(std::function<void()>&& function) : _function(std::move(function)) { }
+
+            bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+            {
+                _function();
+                return true;
+            }
+
+        private:
+            std::function<void()> _function;
+        };
+
+        std::multimap<uint64, BasicEvent*> _events;
+        uint64 _time = 0;
+    };
+
+    /// Long lived event adding itself again, like the periodic events of units and scripts
+    template<class Processor>
+    class ReschedulingEvent : public BasicEvent
+    {
+    public:
+        ReschedulingEvent(Processor& events, std::mt19937& rng) : _events(events), _rng(rng) { }
+
+        bool Execute(uint64 /*e_time*/, uint32 /*p_time*/) override
+        {
+            _events.AddEvent(new ReschedulingEvent(_events, _rng), _events.CalculateTime(_rng() % 30000));
+            return true;
+        }
+
+    private:
+        Processor& _events;
+        std::mt19937& _rng;
+    };
+
+    /// Updates 2000 processors for 4000 ticks of 50 ms, every tick a quarter of them gets a short lived lambda event
+    template<class Processor>
+    double RunBenchmark(std::size_t preloadedEvents)
+    {
+        std::mt19937 rng(1);
+        uint64 sink = 0;
+        std::vector<Processor> processors(2000);
+        for (Processor& events : processors)
+            for (std::size_t i = 0; i < preloadedEvents; ++i)
+                events.AddEvent(new ReschedulingEvent<Processor>(events, rng), events.CalculateTime(rng() % 30000));
+
+        auto const start = std::chrono::steady_clock::now();
+        for (uint32 tick = 0; tick < 4000; ++tick)
+        {
+            for (Processor& events : processors)
+            {
+                if (rng() % 4 == 0)
+                    events.AddEventAtOffset([&sink, tick]() { sink += tick; }, Milliseconds(rng() % 1000));
+
+                events.Update(50);
+            }
+        }
+
+        auto const end = std::chrono::steady_clock::now();
+        EXPECT_GT(sink, 0u);
+        return std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    class RecordingEvent : public BasicEvent
+    {
+    public:
+        RecordingEvent(int id, EventProcessor& events, ExecutionLog& log, std::map<int, BasicEvent*>& pending) :
+            _id(id), _events(events), _log(log), _pending(pending)
+        {
+            _pending[_id] = this;
+        }
+
+        ~RecordingEvent() override { _pending.erase(_id); }
+
+        bool Execute(uint64 e_time, uint32 /*p_time*/) override
+        {
+            _log.emplace_back(_id, e_time);
+            if (HasChild(_id))
+                _events.AddEvent(new RecordingEvent(_id + CHILD_ID_OFFSET, _events, _log, _pending), _events.CalculateTime(GetChildOffset(_id)));
+
+            return true;
+        }
+
+    private:
+        int _id;
+        EventProcessor& _events;
+        ExecutionLog& _log;
+        std::map<int, BasicEvent*>& _pending;
+    };
+
+    // runs random operations against an EventProcessor and the reference, at most maxPending events are queued
+    void CompareWithReference(uint64 seed, std::size_t maxPending, uint32 steps)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_int_distribution<int> operation(0, 99);
+        std::uniform_int_distribution<uint32> groupDist(0, 3);
+
+        // mostly near events, some on every level of the wheel and a few beyond its range
+        auto randomOffset = [&rng]() -> uint64
+        {
+            std::uniform_int_distribution<uint32> bits(0, 38);
+            uint32 const maxBits = std::uniform_int_distribution<int>(0, 9)(rng) ? bits(rng) % 14 : bits(rng);
+            return std::uniform_int_distribution<uint64>(0, (uint64(1) << maxBits))(rng);
+        };
+
+        EventProcessor events;
+        ExecutionLog log;
+        std::map<int, BasicEvent*> pending;
+        ReferenceProcessor reference;
+        int nextId = 1;
+
+        for (uint32 step = 0; step < steps; ++step)
+        {
+            int const op = operation(rng);
+            if (op < 55)
+            {
+                if (pending.size() >= maxPending)
+                    continue;
+
+                uint64 const time = reference.GetTime() + randomOffset();
+                uint8 const group = uint8(groupDist(rng));
+                int const id = nextId++;
+                events.AddEvent(new RecordingEvent(id, events, log, pending), time, true, group);
+                reference.Add(id, time, group);
+            }
+            else if (op < 90)
+            {
+                uint32 const diff = std::uniform_int_distribution<int>(0, 199)(rng) ? uint32(rng() % 400) : uint32(rng() % (uint64(1) << 32));
+                events.Update(diff);
+                reference.Update(diff);
+            }
+            else if (op < 92)
+            {
+                uint8 const group = uint8(groupDist(rng));
+                events.CancelEventGroup(group);
+                reference.CancelGroup(group);
+            }
+            else if (!pending.empty())
+            {
+                auto itr = pending.lower_bound(int(rng() % nextId));
+                if (itr == pending.end())
+                    itr = pending.begin();
+
+                uint64 const time = reference.GetTime() + randomOffset();
+                int const id = itr->first;
+                events.ModifyEventTime(itr->second, Milliseconds(time));
+                reference.Modify(id, time);
+            }
+
+            ASSERT_EQ(log.size(), reference.Log.size()) << "step " << step;
+        }
+
+        EXPECT_EQ(log, reference.Log);
+
+        events.KillAllEvents(true);
+        EXPECT_TRUE(pending.empty());
+    }
+}
+
+TEST(EventProcessorTest, ExecutesInTimeAndInsertionOrder)
+{
+    EventProcessor events;
+    ExecutionLog log;
+    std::map<int, BasicEvent*> pending;
+    int order = 1;
+
+    // same time events keep their insertion order, no matter the level they were added to
+    events.AddEvent(new RecordingEvent(order++, events, log, pending), 5000);
+    events.AddEvent(new RecordingEvent(order++, events, log, pending), 70);
+    events.Update(4000);
+    events.AddEvent(new RecordingEvent(order++, events, log, pending), 5000);
+    events.AddEvent(new RecordingEvent(order++, events, log, pending), events.CalculateTime(0));
+    events.Update(2000);
+
+    ExecutionLog const expected = { { 2, 4000 }, { 4, 6000 }, { 1, 6000 }, { 3, 6000 } };
+    EXPECT_EQ(log, expected);
+    EXPECT_TRUE(pending.empty());
+}
+
+TEST(EventProcessorTest, MatchesMultimapOrder)
+{
+    CompareWithReference(20240611, std::numeric_limits<std::size_t>::max(), 50000);
+}
+
+TEST(EventProcessorTest, MatchesMultimapOrderWithFewEvents)
+{
+    // stays in the sorted list
+    CompareWithReference(20241019, EventProcessor::EVENT_LIST_MAX / 2, 50000);
+
+    // switches to the wheel when the list is full
+    CompareWithReference(20241020, EventProcessor::EVENT_LIST_MAX + 8, 50000);
+}
+
+// run with --gtest_also_run_disabled_tests, also shows whether EVENT_LIST_MAX is still the right switch to the wheel
+TEST(EventProcessorTest, DISABLED_BenchmarkAgainstMultimap)
+{
+    for (std::size_t preloaded : { 0, 1, 4, 16, 32, 64 })
+    {
+        double const multimap = RunBenchmark<MultimapEventProcessor>(preloaded);
+        double const processor = RunBenchmark<EventProcessor>(preloaded);
+        std::printf("%2zu preloaded events: multimap %7.1f ms, EventProcessor %7.1f ms\n", preloaded, multimap, processor);
+    }
+}
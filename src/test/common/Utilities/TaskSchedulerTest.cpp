@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "TaskScheduler.h"
+#include "gtest/gtest.h"
+#include <array>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+TEST(TaskSchedulerTest, ExecutesInTimeAndScheduleOrder)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    for (int id : { 1, 2, 3 })
+        scheduler.Schedule(id == 2 ? 100ms : 200ms, [&executed, id](TaskContext /*context*/)
+        {
+            executed.push_back(id);
+        });
+
+    // callables too big to be stored inline
+    std::array<uint64, 16> payload{};
+    payload.back() = 4;
+    scheduler.Schedule(100ms, [&executed, payload](TaskContext /*context*/)
+    {
+        executed.push_back(int(payload.back()));
+    });
+
+    scheduler.Update(200ms);
+    EXPECT_EQ(executed, std::vector<int>({ 2, 4, 1, 3 }));
+}
+
+TEST(TaskSchedulerTest, RepeatedTaskIsQueuedDuringItsInvocation)
+{
+    TaskScheduler scheduler;
+    uint32 invocations = 0;
+    scheduler.Schedule(100ms, 1, [&invocations](TaskContext context)
+    {
+        ++invocations;
+        context.Repeat();
+        if (context.GetRepeatCounter() == 3)
+            context.CancelGroup(1);
+    });
+
+    scheduler.Update(200ms);
+    EXPECT_TRUE(scheduler.IsGroupScheduled(1));
+
+    scheduler.Update(1s);
+    EXPECT_EQ(invocations, 3u);
+    EXPECT_FALSE(scheduler.IsGroupScheduled(1));
+}
+
+TEST(TaskSchedulerTest, DelayAndReschedule)
+{
+    TaskScheduler scheduler;
+    std::vector<int> executed;
+    scheduler.Schedule(100ms, 1, [&executed](TaskContext /*context*/) { executed.push_back(1); });
+    scheduler.Schedule(150ms, 2, [&executed](TaskContext /*context*/) { executed.push_back(2); });
+    scheduler.Schedule(150ms, [&executed](TaskContext /*context*/) { executed.push_back(3); });
+    scheduler.DelayGroup(1, 50ms);
+    scheduler.RescheduleGroup(2, 300ms);
+
+    scheduler.Update(150ms);
+    EXPECT_EQ(executed, std::vector<int>({ 3, 1 }));
+
+    scheduler.Update(150ms);
+    EXPECT_EQ(executed, std::vector<int>({ 3, 1, 2 }));
+}
@@ -0,0 +1,41 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#ifndef AZEROTHCORE_WORLDOBJECTMOCK_H
+#define AZEROTHCORE_WORLDOBJECTMOCK_H
+
+#include "Object.h"
+#include "UpdateFields.h"
+
+/// WorldObject which is neither a unit nor added to a map, zone, area and phase are set directly.
+/// Unit and player conditions are never met for it, their player lookups still run
+class WorldObjectMock : public WorldObject
+{
+public:
+    WorldObjectMock(uint32 entry = 0, uint32 mapId = 0, uint32 zoneId = 0, uint32 areaId = 0) : WorldObject(false)
+    {
+        m_valuesCount = OBJECT_END;
+        _InitValues();
+        SetEntry(entry);
+        WorldRelocate(mapId);
+        _zoneId = zoneId;
+        _areaId = areaId;
+    }
+};
+
+#endif //AZEROTHCORE_WORLDOBJECTMOCK_H
@@ -0,0 +1,300 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ConditionMgr.h"
+#include "WorldObjectMock.h"
+#include "gtest/gtest.h"
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Condition which is met or not without looking at its target, CONDITION_TC_END is never met unless negated
+    Condition MakeCondition(uint32 elseGroup, bool meets)
+    {
+        Condition cond;
+        cond.ElseGroup = elseGroup;
+        cond.ConditionType = CONDITION_TC_END;
+        cond.NegativeCondition = meets;
+        return cond;
+    }
+
+    Condition MakeCondition(uint32 elseGroup, ConditionTypes type, uint32 value1, uint32 value2 = 0, bool negative = false)
+    {
+        Condition cond;
+        cond.ElseGroup = elseGroup;
+        cond.ConditionType = type;
+        cond.ConditionValue1 = value1;
+        cond.ConditionValue2 = value2;
+        cond.NegativeCondition = negative;
+        return cond;
+    }
+
+    /// The former evaluation, collecting the result of every ElseGroup in a std::map. Lists without references only
+    bool EvaluateWithElseGroupMap(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
+    {
+        if (conditions.empty())
+            return true;
+
+        std::map<uint32, bool> elseGroupStore;
+        for (Condition* cond : conditions)
+        {
+            if (!cond->isLoaded())
+                continue;
+
+            std::map<uint32, bool>::const_iterator itr = elseGroupStore.find(cond->ElseGroup);
+            if (itr == elseGroupStore.end())
+                elseGroupStore[cond->ElseGroup] = true;
+            else if (!itr->second)
+                continue;
+
+            if (!cond->Meets(sourceInfo))
+                elseGroupStore[cond->ElseGroup] = false;
+        }
+
+        for (std::map<uint32, bool>::const_iterator itr = elseGroupStore.begin(); itr != elseGroupStore.end(); ++itr)
+            if (itr->second)
+                return true;
+
+        return false;
+    }
+
+    /// Condition lists shaped like the ones of loot and spell implicit targets, and the objects they are evaluated for
+    class ConditionWorkload
+    {
+    public:
+        explicit ConditionWorkload(uint32 seed) : _rng(seed)
+        {
+            for (uint32 i = 0; i < 64; ++i)
+                Targets.push_back(std::make_unique<WorldObjectMock>(1000 + Random(32), Random(4), 100 + Random(8), 200 + Random(16)));
+
+            for (uint32 i = 0; i < 2000; ++i)
+                LootLists.push_back(MakeLootConditions());
+
+            for (uint32 i = 0; i < 200; ++i)
+                ImplicitTargetLists.push_back(MakeImplicitTargetConditions());
+        }
+
+        std::vector<std::unique_ptr<WorldObjectMock>> Targets;
+        std::vector<ConditionList> LootLists;
+        std::vector<ConditionList> ImplicitTargetLists;
+
+    private:
+        uint32 Random(uint32 count) { return uint32(_rng() % count); }
+
+        void Add(ConditionList& conditions, Condition const& cond)
+        {
+            _conditions.push_back(cond);
+            ConditionMgr::AddToConditionList(conditions, &_conditions.back());
+        }
+
+        // quest drops, quest drops with an alternative, zone and map limited drops
+        ConditionList MakeLootConditions()
+        {
+            ConditionList conditions;
+            uint32 const quest = 1 + Random(5000);
+            switch (Random(4))
+            {
+                case 0:
+                    Add(conditions, MakeCondition(0, CONDITION_QUESTTAKEN, quest));
+                    break;
+                case 1:
+                    Add(conditions, MakeCondition(0, CONDITION_QUESTTAKEN, quest));
+                    Add(conditions, MakeCondition(1, CONDITION_QUESTREWARDED, quest, 0, true));
+                    Add(conditions, MakeCondition(1, CONDITION_AREAID, 200 + Random(16)));
+                    break;
+                case 2:
+                    Add(conditions, MakeCondition(0, CONDITION_ZONEID, 100 + Random(8)));
+                    break;
+                default:
+                    Add(conditions, MakeCondition(0, CONDITION_MAPID, Random(4)));
+                    Add(conditions, MakeCondition(0, CONDITION_PHASEMASK, PHASEMASK_NORMAL));
+                    Add(conditions, MakeCondition(0, CONDITION_QUESTREWARDED, quest, 0, true));
+                    break;
+            }
+
+            return conditions;
+        }
+
+        // one ElseGroup for each entry the spell may hit, some also limited to a zone
+        ConditionList MakeImplicitTargetConditions()
+        {
+            ConditionList conditions;
+            uint32 const groups = 1 + Random(8);
+            for (uint32 group = 0; group < groups; ++group)
+            {
+                Add(conditions, MakeCondition(group, CONDITION_OBJECT_ENTRY_GUID, TYPEID_OBJECT, 1000 + Random(32)));
+                if (!Random(3))
+                    Add(conditions, MakeCondition(group, CONDITION_ZONEID, 100 + Random(8)));
+            }
+
+            return conditions;
+        }
+
+        std::mt19937 _rng;
+        std::deque<Condition> _conditions;
+    };
+
+    /// Evaluates every list for every target like the spell target searchers do, reusing the source info. Returns the number of met lists
+    template<class Evaluator>
+    uint32 EvaluateAll(std::vector<ConditionList> const& lists, std::vector<std::unique_ptr<WorldObjectMock>> const& targets, Evaluator evaluate)
+    {
+        uint32 met = 0;
+        ConditionSourceInfo sourceInfo(nullptr);
+        for (ConditionList const& conditions : lists)
+        {
+            for (std::unique_ptr<WorldObjectMock> const& target : targets)
+            {
+                sourceInfo.mConditionTargets[0] = target.get();
+                if (evaluate(sourceInfo, conditions))
+                    ++met;
+            }
+        }
+
+        return met;
+    }
+
+    bool EvaluateWithConditionMgr(ConditionSourceInfo& sourceInfo, ConditionList const& conditions)
+    {
+        return sConditionMgr->IsObjectMeetToConditions(sourceInfo, conditions);
+    }
+
+    class ConditionMgrTest : public ::testing::Test
+    {
+    protected:
+        bool Evaluate(ConditionList const& conditions)
+        {
+            // the conditions of these tests do not look at their target, it only has to be present
+            ConditionSourceInfo sourceInfo(&_target);
+            return sConditionMgr->IsObjectMeetToConditions(sourceInfo, conditions);
+        }
+
+    private:
+        WorldObjectMock _target;
+    };
+}
+
+TEST(ConditionListTest, AddKeepsElseGroupsTogether)
+{
+    std::vector<Condition> conditions = { MakeCondition(1, true), MakeCondition(0, true), MakeCondition(2, true), MakeCondition(1, true), MakeCondition(0, true) };
+
+    ConditionList list;
+    for (Condition& cond : conditions)
+        ConditionMgr::AddToConditionList(list, &cond);
+
+    ConditionList const expected = { &conditions[1], &conditions[4], &conditions[0], &conditions[3], &conditions[2] };
+    EXPECT_EQ(list, expected);
+}
+
+TEST_F(ConditionMgrTest, EmptyListIsMet)
+{
+    EXPECT_TRUE(Evaluate(ConditionList()));
+}
+
+TEST_F(ConditionMgrTest, AllConditionsOfAGroupMustBeMet)
+{
+    Condition met = MakeCondition(0, true);
+    Condition notMet = MakeCondition(0, false);
+
+    EXPECT_TRUE(Evaluate({ &met, &met }));
+    EXPECT_FALSE(Evaluate({ &met, &notMet }));
+    EXPECT_FALSE(Evaluate({ &notMet, &met }));
+}
+
+TEST_F(ConditionMgrTest, AnyElseGroupMayBeMet)
+{
+    Condition firstMet = MakeCondition(0, true);
+    Condition firstNotMet = MakeCondition(0, false);
+    Condition secondMet = MakeCondition(1, true);
+    Condition secondNotMet = MakeCondition(1, false);
+
+    EXPECT_TRUE(Evaluate({ &firstNotMet, &secondMet }));
+    EXPECT_TRUE(Evaluate({ &firstMet, &secondNotMet }));
+    EXPECT_TRUE(Evaluate({ &firstMet, &firstNotMet, &secondMet, &secondMet }));
+    EXPECT_FALSE(Evaluate({ &firstMet, &firstNotMet, &secondMet, &secondNotMet }));
+}
+
+TEST_F(ConditionMgrTest, NotLoadedConditionsAreIgnored)
+{
+    Condition notLoaded;
+    notLoaded.ElseGroup = 1;
+    Condition notMet = MakeCondition(0, false);
+    Condition met = MakeCondition(1, true);
+
+    // a group without loaded conditions does not pass on its own
+    EXPECT_FALSE(Evaluate({ &notLoaded }));
+    EXPECT_FALSE(Evaluate({ &notMet, &notLoaded }));
+    EXPECT_TRUE(Evaluate({ &notMet, &notLoaded, &met }));
+}
+
+TEST_F(ConditionMgrTest, MissingReferenceIsMet)
+{
+    Condition reference;
+    reference.ReferenceId = 0xFFFFFF;
+    Condition notMet = MakeCondition(0, false);
+    Condition met = MakeCondition(0, true);
+
+    EXPECT_TRUE(Evaluate({ &reference }));
+    EXPECT_TRUE(Evaluate({ &reference, &met }));
+    EXPECT_FALSE(Evaluate({ &reference, &notMet }));
+}
+
+TEST(ConditionWorkloadTest, MatchesElseGroupMapWalk)
+{
+    ConditionWorkload workload(20241019);
+    for (std::vector<ConditionList> const* lists : { &workload.LootLists, &workload.ImplicitTargetLists })
+    {
+        for (ConditionList const& conditions : *lists)
+        {
+            for (std::unique_ptr<WorldObjectMock> const& target : workload.Targets)
+            {
+                ConditionSourceInfo sourceInfo(target.get());
+                ConditionSourceInfo referenceInfo(target.get());
+                ASSERT_EQ(EvaluateWithConditionMgr(sourceInfo, conditions), EvaluateWithElseGroupMap(referenceInfo, conditions));
+            }
+        }
+    }
+}
+
+// run with --gtest_also_run_disabled_tests
+TEST(ConditionWorkloadTest, DISABLED_LootAndImplicitTargets)
+{
+    ConditionWorkload workload(20241020);
+    auto measure = [&workload](std::vector<ConditionList> const& lists, auto evaluate, uint32& met)
+    {
+        auto const start = std::chrono::steady_clock::now();
+        for (uint32 i = 0; i < 50; ++i)
+            met = EvaluateAll(lists, workload.Targets, evaluate);
+
+        return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    for (auto const& [name, lists] : { std::make_pair("loot", &workload.LootLists), std::make_pair("implicit target", &workload.ImplicitTargetLists) })
+    {
+        uint32 metMap = 0;
+        uint32 metMgr = 0;
+        double const map = measure(*lists, EvaluateWithElseGroupMap, metMap);
+        double const mgr = measure(*lists, EvaluateWithConditionMgr, metMgr);
+        EXPECT_EQ(metMap, metMgr);
+        std::printf("%s conditions: ElseGroup map %7.1f ms, ConditionMgr %7.1f ms (%u met)\n", name, map, mgr, metMgr);
+    }
+}
@@ -0,0 +1,31 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "Creature.h"
+#include "gtest/gtest.h"
+
+TEST(CreatureRespawnTest, OnlyDeadCreaturesStayRespawnDormant)
+{
+    EXPECT_TRUE(Creature::CanBeRespawnDormant(DeathState::Dead));
+
+    // states scripts revive creatures with, setDeathState wakes the creature up for them
+    EXPECT_FALSE(Creature::CanBeRespawnDormant(DeathState::Alive));
+    EXPECT_FALSE(Creature::CanBeRespawnDormant(DeathState::JustRespawned));
+    EXPECT_FALSE(Creature::CanBeRespawnDormant(DeathState::JustDied));
+    EXPECT_FALSE(Creature::CanBeRespawnDormant(DeathState::Corpse));
+}
@@ -0,0 +1,152 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "UpdateData.h"
+#include "UpdateFieldFlags.h"
+#include "UpdateMask.h"
+#include "gtest/gtest.h"
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // Field by field selection and packing, as values updates were built before the block wise mask
+    ByteBuffer BuildReference(uint8 updateType, std::vector<uint32> const& values, std::vector<bool> const& changes, uint32 const* flags, uint32 visibleFlag, uint32 notifyFlags)
+    {
+        uint32 count = uint32(values.size());
+        std::vector<uint32> blocks((count + 31) / 32, 0);
+        std::vector<uint32> fields;
+        for (uint32 index = 0; index < count; ++index)
+        {
+            if ((notifyFlags & flags[index]) ||
+                ((updateType == UPDATETYPE_VALUES ? changes[index] : values[index] != 0) && (flags[index] & visibleFlag)))
+            {
+                blocks[index / 32] |= 1u << (index % 32);
+                fields.push_back(values[index]);
+            }
+        }
+
+        ByteBuffer data;
+        data << uint8(blocks.size());
+        for (uint32 block : blocks)
+            data << block;
+
+        for (uint32 value : fields)
+            data << value;
+
+        return data;
+    }
+
+    ByteBuffer BuildMasked(uint8 updateType, std::vector<uint32> const& values, std::vector<bool> const& changes, uint32 const* flags, uint32 visibleFlag, uint32 notifyFlags)
+    {
+        UpdateMask changesMask(uint32(values.size()));
+        for (uint32 index = 0; index < values.size(); ++index)
+            if (changes[index])
+                changesMask.SetBit(index);
+
+        UpdateMask updateMask;
+        BuildValuesUpdateMask(updateMask, updateType, changesMask, values.data(), flags, visibleFlag, notifyFlags);
+
+        ByteBuffer data;
+        data << uint8(updateMask.GetBlockCount());
+        updateMask.AppendToPacket(&data);
+        updateMask.ForEachSetBit([&](uint32 index) { data << values[index]; });
+        return data;
+    }
+}
+
+TEST(UpdateMaskTest, ForEachSetBitIsOrdered)
+{
+    UpdateMask mask(PLAYER_END);
+    std::vector<uint32> expected = { 0, 1, 31, 32, 63, 64, 500, PLAYER_END - 1 };
+    for (uint32 index : expected)
+        mask.SetBit(index);
+
+    std::vector<uint32> visited;
+    mask.ForEachSetBit([&](uint32 index) { visited.push_back(index); });
+    EXPECT_EQ(visited, expected);
+
+    mask.UnsetBit(500);
+    EXPECT_FALSE(mask.GetBit(500));
+    EXPECT_TRUE(mask.GetBit(PLAYER_END - 1));
+
+    mask.Clear();
+    visited.clear();
+    mask.ForEachSetBit([&](uint32 index) { visited.push_back(index); });
+    EXPECT_TRUE(visited.empty());
+}
+
+TEST(UpdateMaskTest, ValuesUpdateMatchesFieldByField)
+{
+    struct ObjectLayout
+    {
+        uint32 const* Flags;
+        uint32 Count;
+    };
+
+    ObjectLayout const layouts[] =
+    {
+        { ItemUpdateFieldFlags, ITEM_END },
+        { ItemUpdateFieldFlags, CONTAINER_END },
+        { UnitUpdateFieldFlags, UNIT_END },
+        { UnitUpdateFieldFlags, PLAYER_END },
+        { GameObjectUpdateFieldFlags, GAMEOBJECT_END },
+        { DynamicObjectUpdateFieldFlags, DYNAMICOBJECT_END },
+        { CorpseUpdateFieldFlags, CORPSE_END }
+    };
+
+    uint32 const visibleFlags[] =
+    {
+        UF_FLAG_PUBLIC,
+        UF_FLAG_PUBLIC | UF_FLAG_PARTY_MEMBER,
+        UF_FLAG_PUBLIC | UF_FLAG_OWNER | UF_FLAG_ITEM_OWNER,
+        UF_FLAG_PUBLIC | UF_FLAG_PRIVATE | UF_FLAG_OWNER | UF_FLAG_PARTY_MEMBER | UF_FLAG_SPECIAL_INFO,
+    };
+
+    std::mt19937 rng(12345);
+    std::bernoulli_distribution changed(0.1);
+    std::bernoulli_distribution nonZero(0.3);
+
+    for (ObjectLayout const& layout : layouts)
+    {
+        for (uint32 iteration = 0; iteration < 20; ++iteration)
+        {
+            std::vector<uint32> values(layout.Count);
+            std::vector<bool> changes(layout.Count);
+            for (uint32 index = 0; index < layout.Count; ++index)
+            {
+                values[index] = nonZero(rng) ? uint32(rng()) | 1 : 0;
+                changes[index] = changed(rng);
+            }
+
+            for (uint8 updateType : { uint8(UPDATETYPE_VALUES), uint8(UPDATETYPE_CREATE_OBJECT2) })
+            {
+                for (uint32 visibleFlag : visibleFlags)
+                {
+                    for (uint32 notifyFlags : { uint32(UF_FLAG_NONE), uint32(UF_FLAG_DYNAMIC), visibleFlag & UF_FLAG_SPECIAL_INFO })
+                    {
+                        ByteBuffer expected = BuildReference(updateType, values, changes, layout.Flags, visibleFlag, notifyFlags);
+                        ByteBuffer actual = BuildMasked(updateType, values, changes, layout.Flags, visibleFlag, notifyFlags);
+                        ASSERT_EQ(expected.size(), actual.size());
+                        EXPECT_EQ(0, std::memcmp(expected.contents(), actual.contents(), expected.size()));
+                    }
+                }
+            }
+        }
+    }
+}
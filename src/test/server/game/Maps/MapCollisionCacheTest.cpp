@@ -0,0 +1,82 @@
+/*
+ * This file is part of the AzerothCore Project. See AUTHORS file for Copyright information
+ *
+ * This program is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Affero General Public License as published by the
+ * Free Software Foundation; either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE. See the GNU Affero General Public License for
+ * more details.
+ *
+ * You should have received a copy of the GNU General Public License along
+ * with this program. If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#include "MapCollisionCache.h"
+#include "gtest/gtest.h"
+
+namespace
+{
+    bool HasLineOfSight(MapCollisionCache& cache, float x1, float y1, float x2, float y2)
+    {
+        bool result = false;
+        return cache.GetLineOfSight(x1, y1, 0.0f, x2, y2, 0.0f, 1, 0, result) && result;
+    }
+}
+
+TEST(MapCollisionCacheTest, InvalidateDropsEverything)
+{
+    MapCollisionCache cache(64);
+    cache.StoreLineOfSight(0.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 1, 0, true);
+    cache.StoreHeight(500.0f, 500.0f, 10.0f, 50.0f, 1, 1, 3.0f);
+    EXPECT_TRUE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+
+    cache.Invalidate();
+
+    float height;
+    EXPECT_FALSE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+    EXPECT_FALSE(cache.GetHeight(500.0f, 500.0f, 10.0f, 50.0f, 1, 1, height));
+}
+
+TEST(MapCollisionCacheTest, InvalidateRegionKeepsDistantEntries)
+{
+    MapCollisionCache cache(64);
+    cache.StoreLineOfSight(0.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 1, 0, true);
+    cache.StoreHeight(500.0f, 500.0f, 10.0f, 50.0f, 1, 1, 3.0f);
+
+    // a model moving across the middle of the line
+    cache.InvalidateRegion(4.0f, -1.0f, 6.0f, 1.0f);
+
+    float height = 0.0f;
+    EXPECT_FALSE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+    EXPECT_TRUE(cache.GetHeight(500.0f, 500.0f, 10.0f, 50.0f, 1, 1, height));
+    EXPECT_EQ(height, 3.0f);
+
+    // entries stored after the change are valid again
+    cache.StoreLineOfSight(0.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 1, 0, true);
+    EXPECT_TRUE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+    cache.InvalidateRegion(100.0f, 100.0f, 110.0f, 110.0f);
+    EXPECT_TRUE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+}
+
+TEST(MapCollisionCacheTest, ForgottenRegionsDropOlderEntries)
+{
+    MapCollisionCache cache(64);
+    cache.StoreLineOfSight(0.0f, 0.0f, 0.0f, 10.0f, 0.0f, 0.0f, 1, 0, true);
+
+    // far away changes, each followed by a store so they are not merged
+    for (std::size_t i = 0; i < MapCollisionCache::DIRTY_REGIONS; ++i)
+    {
+        cache.InvalidateRegion(1000.0f, 1000.0f, 1010.0f, 1010.0f);
+        cache.StoreHeight(2000.0f, 2000.0f, 0.0f, 50.0f, 1, 1, 0.0f);
+    }
+
+    EXPECT_TRUE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+
+    cache.InvalidateRegion(1000.0f, 1000.0f, 1010.0f, 1010.0f);
+    EXPECT_FALSE(HasLineOfSight(cache, 0.0f, 0.0f, 10.0f, 0.0f));
+}
@@ -18,9 +18,13 @@
 #include "mpq_libmpq04.h"
 #include <cstdio>
 #include <deque>
+#include <mutex>
 
 ArchiveSet gOpenArchives;
 
+// libmpq archive handles must not be used from several threads at once
+static std::mutex gArchivesLock;
+
 MPQArchive::MPQArchive(const char* filename)
 {
     int result = libmpq__archive_open(&mpq_a, filename, -1);
@@ -65,6 +69,8 @@ MPQFile::MPQFile(const char* filename):
     pointer(0),
     size(0)
 {
+    std::lock_guard<std::mutex> guard(gArchivesLock);
+
     for (auto & gOpenArchive : gOpenArchives)
     {
         mpq_archive* mpq_a = gOpenArchive->mpq_a;
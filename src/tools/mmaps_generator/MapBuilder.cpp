@@ -22,11 +22,116 @@
 #include "ModelInstance.h"
 #include "PathCommon.h"
 #include "StringFormat.h"
+#include "Timer.h"
 #include "VMapFactory.h"
 #include "VMapMgr2.h"
 #include <DetourCommon.h>
 #include <DetourNavMesh.h>
 #include <DetourNavMeshBuilder.h>
+#include <algorithm>
+#include <type_traits>
+
+namespace
+{
+    // bump to force a full rebuild after changes to the generator that don't show up in its inputs
+    constexpr uint32 TILE_HASH_VERSION = 1;
+
+    // FNV-1a, only used to detect changed tile inputs between runs
+    class InputHasher
+    {
+    public:
+        void Add(void const* data, std::size_t size)
+        {
+            uint8 const* bytes = static_cast<uint8 const*>(data);
+            for (std::size_t i = 0; i < size; ++i)
+                _hash = (_hash ^ bytes[i]) * 1099511628211ULL;
+        }
+
+        template<class T>
+        void Add(T const& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Add(&value, sizeof(T));
+        }
+
+        void AddString(std::string const& value)
+        {
+            Add(uint32(value.size()));
+            Add(value.data(), value.size());
+        }
+
+        // a missing file hashes differently than an empty one
+        void AddFile(std::string const& fileName)
+        {
+            AddString(fileName);
+
+            FILE* file = fopen(fileName.c_str(), "rb");
+            Add(uint8(file ? 1 : 0));
+            if (!file)
+                return;
+
+            char buffer[64 * 1024];
+            std::size_t count;
+            while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+                Add(buffer, count);
+
+            fclose(file);
+        }
+
+        [[nodiscard]] uint64 GetHash() const { return _hash; }
+
+    private:
+        uint64 _hash = 14695981039346656037ULL;
+    };
+
+    uint64 OffMeshKey(uint32 mapID, uint32 tileX, uint32 tileY)
+    {
+        return (uint64(mapID) << 32) | (uint64(tileX) << 16) | tileY;
+    }
+
+    // name of the global model of a non tiled map, see StaticMapTree::InitMap
+    std::string GetGlobalModelName(std::string const& treeFileName)
+    {
+        FILE* rf = fopen(treeFileName.c_str(), "rb");
+        if (!rf)
+            return {};
+
+        char chunk[8];
+        char tiled = '\0';
+        BIH tree;
+        ModelSpawn spawn;
+        bool found = fread(chunk, 8, 1, rf) == 1 && fread(&tiled, sizeof(char), 1, rf) == 1 && fread(chunk, 4, 1, rf) == 1 &&
+            tree.readFromFile(rf) && fread(chunk, 4, 1, rf) == 1 && !tiled && ModelSpawn::readFromFile(rf, spawn);
+
+        fclose(rf);
+        return found ? spawn.name : std::string();
+    }
+
+    // names of the models spawned on a tile, see StaticMapTree::LoadMapTile
+    void GetTileModelNames(std::string const& tileFileName, std::vector<std::string>& names)
+    {
+        FILE* tf = fopen(tileFileName.c_str(), "rb");
+        if (!tf)
+            return;
+
+        char chunk[8];
+        uint32 numSpawns = 0;
+        if (fread(chunk, 8, 1, tf) == 1 && fread(&numSpawns, sizeof(uint32), 1, tf) == 1)
+        {
+            for (uint32 i = 0; i < numSpawns; ++i)
+            {
+                ModelSpawn spawn;
+                uint32 referencedVal;
+                if (!ModelSpawn::readFromFile(tf, spawn) || fread(&referencedVal, sizeof(uint32), 1, tf) != 1)
+                    break;
+
+                names.push_back(spawn.name);
+            }
+        }
+
+        fclose(tf);
+    }
+}
 
 namespace MMAP
 {
@@ -83,6 +188,7 @@ namespace MMAP
         m_threads = std::max(1u, m_threads);
 
         discoverTiles();
+        readOffMeshLines();
     }
 
     /**************************************************************************/
@@ -206,16 +312,12 @@ namespace MMAP
     /**************************************************************************/
     void MapBuilder::buildMaps(Optional<uint32> mapID)
     {
-        printf("Using %u threads to generate mmaps\n", m_threads);
-
-        for (unsigned int i = 0; i < m_threads; ++i)
-        {
-            m_tileBuilders.push_back(new TileBuilder(this, m_skipLiquid, m_bigBaseUnit, m_debugOutput));
-        }
+        uint32 startTime = getMSTime();
 
+        std::vector<uint32> maps;
         if (mapID)
         {
-            buildMap(*mapID);
+            maps.push_back(*mapID);
         }
         else
         {
@@ -223,10 +325,31 @@ namespace MMAP
             for (TileList::iterator it = m_tiles.begin(); it != m_tiles.end(); ++it)
             {
                 if (!shouldSkipMap(it->m_mapId))
-                    buildMap(it->m_mapId);
+                    maps.push_back(it->m_mapId);
             }
         }
 
+        // All maps share a single queue, a thread done with its tile takes the next one whatever map it belongs to.
+        // Queue the maps with the most tiles first, so the tail of the run is made of small maps and no thread idles
+        // while another one still works through a continent.
+        std::stable_sort(maps.begin(), maps.end(), [this](uint32 left, uint32 right)
+        {
+            return getTileList(left)->size() > getTileList(right)->size();
+        });
+
+        for (uint32 map : maps)
+            createBuildState(map, getTileList(map)->size());
+
+        printf("Using %u threads to generate mmaps\n", m_threads);
+
+        for (unsigned int i = 0; i < m_threads; ++i)
+        {
+            m_tileBuilders.push_back(new TileBuilder(this, m_skipLiquid, m_bigBaseUnit, m_debugOutput));
+        }
+
+        for (uint32 map : maps)
+            buildMap(map);
+
         while (!_queue.Empty())
         {
             std::this_thread::sleep_for(std::chrono::milliseconds(1000));
@@ -240,6 +363,8 @@ namespace MMAP
             delete builder;
 
         m_tileBuilders.clear();
+
+        printBuildReport(startTime);
     }
 
     /**************************************************************************/
@@ -384,7 +509,7 @@ namespace MMAP
             return;
         }
 
-        /// @todo: delete the old tile as the user clearly wants to rebuild it
+        createBuildState(mapID, 1);
 
         TileBuilder tileBuilder = TileBuilder(this, m_skipLiquid, m_bigBaseUnit, m_debugOutput);
         tileBuilder.buildTile(mapID, tileX, tileY, navMesh);
@@ -461,14 +586,24 @@ namespace MMAP
     /**************************************************************************/
     void TileBuilder::buildTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
     {
-        if(shouldSkipTile(mapID, tileX, tileY))
+        uint32 startTime = getMSTime();
+        uint64 inputHash = m_mapBuilder->getTileInputHash(mapID, tileX, tileY, *navMesh->getParams());
+
+        if (shouldSkipTile(mapID, tileX, tileY, inputHash))
         {
-            ++m_mapBuilder->m_totalTilesProcessed;
+            m_mapBuilder->onTileDone(mapID, tileX, tileY, inputHash, false, false, startTime);
             return;
         }
 
         printf("%u%% [Map %04i] Building tile [%02u,%02u]\n", m_mapBuilder->currentPercentageDone(), mapID, tileX, tileY);
 
+        bool hasTile = generateTile(mapID, tileX, tileY, navMesh);
+        m_mapBuilder->onTileDone(mapID, tileX, tileY, inputHash, true, hasTile, startTime);
+    }
+
+    /**************************************************************************/
+    bool TileBuilder::generateTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh)
+    {
         MeshData meshData;
 
         // get heightmap data
@@ -479,10 +614,7 @@ namespace MMAP
 
         // if there is no data, give up now
         if (!meshData.solidVerts.size() && !meshData.liquidVerts.size())
-        {
-            ++m_mapBuilder->m_totalTilesProcessed;
-            return;
-        }
+            return false;
 
         // remove unused vertices
         TerrainBuilder::cleanVertices(meshData.solidVerts, meshData.solidTris);
@@ -494,10 +626,7 @@ namespace MMAP
         allVerts.append(meshData.solidVerts);
 
         if (!allVerts.size())
-        {
-            ++m_mapBuilder->m_totalTilesProcessed;
-            return;
-        }
+            return false;
 
         // get bounds of current tile
         float bmin[3], bmax[3];
@@ -507,8 +636,7 @@ namespace MMAP
 
         // build navmesh tile
         buildMoveMapTile(mapID, tileX, tileY, meshData, bmin, bmax, navMesh);
-
-        ++m_mapBuilder->m_totalTilesProcessed;
+        return true;
     }
 
     /**************************************************************************/
@@ -1027,7 +1155,30 @@ namespace MMAP
     }
 
     /**************************************************************************/
-    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const
+    bool TileBuilder::shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash) const
+    {
+        MapBuildState* state = m_mapBuilder->getBuildState(mapID);
+        if (!state)
+            return false;
+
+        TileInputHash stored;
+        {
+            std::lock_guard<std::mutex> guard(state->m_lock);
+            auto itr = state->m_tileHashes.find(StaticMapTree::packTileID(tileX, tileY));
+            if (itr == state->m_tileHashes.end())
+                return false;
+
+            stored = itr->second;
+        }
+
+        if (stored.m_hash != inputHash)
+            return false;
+
+        // same inputs as the last build, only make sure its result is still there
+        return !stored.m_hasTile || hasValidTile(mapID, tileX, tileY);
+    }
+
+    bool TileBuilder::hasValidTile(uint32 mapID, uint32 tileX, uint32 tileY) const
     {
         char fileName[255];
         sprintf(fileName, "mmaps/%03u%02i%02i.mmtile", mapID, tileY, tileX);
@@ -1108,4 +1259,238 @@ namespace MMAP
     {
         return percentageDone(m_totalTiles, m_totalTilesProcessed);
     }
+
+    /**************************************************************************/
+    void MapBuilder::readOffMeshLines()
+    {
+        if (!m_offMeshFilePath)
+            return;
+
+        FILE* fp = fopen(m_offMeshFilePath, "rb");
+        if (!fp)
+            return;
+
+        // same format as TerrainBuilder::loadOffMeshConnections, only the lines it would use for a tile end up in its hash
+        char buf[512];
+        while (fgets(buf, sizeof(buf), fp))
+        {
+            float p0[3], p1[3];
+            uint32 mid, tx, ty;
+            float size;
+            if (sscanf(buf, "%u %u,%u (%f %f %f) (%f %f %f) %f", &mid, &tx, &ty,
+                       &p0[0], &p0[1], &p0[2], &p1[0], &p1[1], &p1[2], &size) != 10)
+                continue;
+
+            m_offMeshLines[OffMeshKey(mid, tx, ty)] += buf;
+        }
+
+        fclose(fp);
+    }
+
+    /**************************************************************************/
+    MapBuildState* MapBuilder::createBuildState(uint32 mapID, uint32 tileCount)
+    {
+        std::unique_ptr<MapBuildState>& state = m_buildStates[mapID];
+        if (!state)
+        {
+            state = std::make_unique<MapBuildState>();
+            state->m_treeHash = getVMapTreeHash(mapID);
+            loadTileHashes(mapID, *state);
+        }
+
+        state->m_pendingTiles = tileCount;
+        return state.get();
+    }
+
+    MapBuildState* MapBuilder::getBuildState(uint32 mapID) const
+    {
+        auto itr = m_buildStates.find(mapID);
+        return itr != m_buildStates.end() ? itr->second.get() : nullptr;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::loadTileHashes(uint32 mapID, MapBuildState& state) const
+    {
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u.mmhash", mapID);
+        FILE* file = fopen(fileName, "rb");
+        if (!file)
+            return;
+
+        // lines are appended as tiles finish, a later line for the same tile replaces the earlier one
+        char buf[128];
+        while (fgets(buf, sizeof(buf), file))
+        {
+            uint32 tileID, hasTile;
+            unsigned long long hash;
+            if (sscanf(buf, "%u %llx %u", &tileID, &hash, &hasTile) != 3)
+                continue;
+
+            state.m_tileHashes[tileID] = { uint64(hash), hasTile != 0 };
+        }
+
+        fclose(file);
+    }
+
+    void MapBuilder::saveTileHashes(uint32 mapID, MapBuildState& state) const
+    {
+        char fileName[255];
+        sprintf(fileName, "mmaps/%03u.mmhash", mapID);
+        FILE* file = fopen(fileName, "wb");
+        if (!file)
+        {
+            printf("[Map %03i] Failed to open %s for writing!\n", mapID, fileName);
+            return;
+        }
+
+        for (auto const& [tileID, tileHash] : state.m_tileHashes)
+            fprintf(file, "%u %016llx %u\n", tileID, (unsigned long long)tileHash.m_hash, tileHash.m_hasTile ? 1 : 0);
+
+        fclose(file);
+    }
+
+    /**************************************************************************/
+    uint64 MapBuilder::getTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMeshParams const& navMeshParams)
+    {
+        InputHasher hasher;
+
+        // generator settings
+        hasher.Add(TILE_HASH_VERSION);
+        hasher.Add(uint32(MMAP_VERSION));
+        hasher.Add(uint32(DT_NAVMESH_VERSION));
+        hasher.Add(m_maxWalkableAngle);
+        hasher.Add(m_bigBaseUnit);
+        hasher.Add(m_skipLiquid);
+
+        float origin[3] = { 0.0f, 0.0f, 0.0f };
+        hasher.Add(GetMapSpecificConfig(mapID, origin, origin, TileConfig(m_bigBaseUnit)));
+        hasher.Add(navMeshParams);
+
+        // terrain of the tile and its neighbours, see TerrainBuilder::loadMap
+        int32 const neighbours[5][2] = { { 0, 0 }, { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+        char fileName[255];
+        for (auto const& offset : neighbours)
+        {
+            sprintf(fileName, "maps/%03u%02u%02u.map", mapID, tileY + offset[1], tileX + offset[0]);
+            hasher.AddFile(fileName);
+        }
+
+        // models, see TerrainBuilder::loadVMap
+        MapBuildState const* state = getBuildState(mapID);
+        hasher.Add(state ? state->m_treeHash : getVMapTreeHash(mapID));
+
+        std::string tileFileName = "vmaps/" + StaticMapTree::getTileFileName(mapID, tileY, tileX);
+        hasher.AddFile(tileFileName);
+
+        std::vector<std::string> modelNames;
+        GetTileModelNames(tileFileName, modelNames);
+        for (std::string const& modelName : modelNames)
+            hasher.Add(getModelHash(modelName));
+
+        // off-mesh connections
+        auto offMesh = m_offMeshLines.find(OffMeshKey(mapID, tileX, tileY));
+        hasher.AddString(offMesh != m_offMeshLines.end() ? offMesh->second : std::string());
+
+        return hasher.GetHash();
+    }
+
+    uint64 MapBuilder::getVMapTreeHash(uint32 mapID)
+    {
+        std::string treeFileName = "vmaps/" + VMapMgr2::getMapFileName(mapID);
+
+        InputHasher hasher;
+        hasher.AddFile(treeFileName);
+
+        std::string globalModel = GetGlobalModelName(treeFileName);
+        if (!globalModel.empty())
+            hasher.Add(getModelHash(globalModel));
+
+        return hasher.GetHash();
+    }
+
+    uint64 MapBuilder::getModelHash(std::string const& name)
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_modelHashLock);
+            auto itr = m_modelHashes.find(name);
+            if (itr != m_modelHashes.end())
+                return itr->second;
+        }
+
+        // two threads may hash the same model at once, both get the same result
+        InputHasher hasher;
+        hasher.AddFile("vmaps/" + name);
+
+        std::lock_guard<std::mutex> guard(m_modelHashLock);
+        return m_modelHashes.emplace(name, hasher.GetHash()).first->second;
+    }
+
+    /**************************************************************************/
+    void MapBuilder::onTileDone(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, bool built, bool hasTile, uint32 startTime)
+    {
+        ++m_totalTilesProcessed;
+
+        MapBuildState* state = getBuildState(mapID);
+        if (!state)
+            return;
+
+        uint32 endTime = getMSTime();
+
+        std::lock_guard<std::mutex> guard(state->m_lock);
+        if (!state->m_tilesBuilt && !state->m_tilesSkipped)
+            state->m_firstTileStart = startTime;
+        else if (int32(startTime - state->m_firstTileStart) < 0)
+            state->m_firstTileStart = startTime;
+
+        state->m_lastTileEnd = endTime;
+        state->m_buildTime += getMSTimeDiff(startTime, endTime);
+
+        if (built)
+        {
+            ++state->m_tilesBuilt;
+
+            uint32 tileID = StaticMapTree::packTileID(tileX, tileY);
+            state->m_tileHashes[tileID] = { inputHash, hasTile };
+
+            // append right away, so an interrupted run doesn't lose the tiles it already built
+            char fileName[255];
+            sprintf(fileName, "mmaps/%03u.mmhash", mapID);
+            if (FILE* file = fopen(fileName, "ab"))
+            {
+                fprintf(file, "%u %016llx %u\n", tileID, (unsigned long long)inputHash, hasTile ? 1 : 0);
+                fclose(file);
+            }
+        }
+        else
+            ++state->m_tilesSkipped;
+
+        // all tiles of the map are done, drop the superseded lines
+        if (state->m_pendingTiles && !--state->m_pendingTiles)
+            saveTileHashes(mapID, *state);
+    }
+
+    /**************************************************************************/
+    void MapBuilder::printBuildReport(uint32 startTime) const
+    {
+        std::vector<std::pair<uint32, MapBuildState const*>> maps;
+        for (auto const& [mapID, state] : m_buildStates)
+            if (state->m_tilesBuilt || state->m_tilesSkipped)
+                maps.emplace_back(mapID, state.get());
+
+        std::sort(maps.begin(), maps.end(), [](auto const& left, auto const& right)
+        {
+            return left.second->m_buildTime > right.second->m_buildTime;
+        });
+
+        printf("\n Map   Built  Skipped   Wall time  Build time\n");
+        for (auto const& [mapID, state] : maps)
+        {
+            printf("%4u  %6u  %7u  %9.1fs  %9.1fs\n", mapID, state->m_tilesBuilt, state->m_tilesSkipped,
+                   getMSTimeDiff(state->m_firstTileStart, state->m_lastTileEnd) / 1000.0, state->m_buildTime / 1000.0);
+        }
+
+        uint32 elapsed = std::max<uint32>(GetMSTimeDiffToNow(startTime), 1);
+        uint32 processed = m_totalTilesProcessed;
+        printf("\n%u tiles processed in %.1fs, %.2f tiles/s\n\n", processed, elapsed / 1000.0, processed * 1000.0 / elapsed);
+    }
 }
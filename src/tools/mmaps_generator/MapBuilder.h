@@ -21,8 +21,12 @@
 #include <atomic>
 #include <list>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "IntermediateValues.h"
@@ -104,6 +108,27 @@ namespace MMAP
         dtNavMeshParams m_navMeshParams;
     };
 
+    // hash of everything a tile was built from, see MapBuilder::getTileInputHash
+    struct TileInputHash
+    {
+        uint64 m_hash;
+        bool m_hasTile;     // false if the inputs produced no geometry, so there is no .mmtile to check
+    };
+
+    // per map bookkeeping of a run, shared by all tile builders
+    struct MapBuildState
+    {
+        std::mutex m_lock;
+        std::map<uint32, TileInputHash> m_tileHashes;   // packed tile id -> inputs of the stored tile
+        uint32 m_pendingTiles{0};
+        uint32 m_tilesBuilt{0};
+        uint32 m_tilesSkipped{0};
+        uint32 m_firstTileStart{0};
+        uint32 m_lastTileEnd{0};
+        uint64 m_buildTime{0};                          // summed over all threads, in ms
+        uint64 m_treeHash{0};                           // .vmtree and global model, shared by all tiles
+    };
+
     /// @todo: move this to its own file. For now it will stay here to keep the changes to a minimum, especially in the cpp file
     class MapBuilder;
     class TileBuilder
@@ -130,9 +155,13 @@ namespace MMAP
                               float bmax[3],
                               dtNavMesh* navMesh);
 
-        bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY) const;
+        bool shouldSkipTile(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash) const;
+        bool hasValidTile(uint32 mapID, uint32 tileX, uint32 tileY) const;
 
     private:
+        // returns false if the tile has no geometry and no .mmtile was written
+        bool generateTile(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMesh* navMesh);
+
         bool m_bigBaseUnit;
         bool m_debugOutput;
 
@@ -191,6 +220,18 @@ namespace MMAP
         uint32 percentageDone(uint32 totalTiles, uint32 totalTilesDone) const;
         uint32 currentPercentageDone() const;
 
+        // incremental builds: tiles whose inputs hash to the value recorded in mmaps/%03u.mmhash are not rebuilt
+        MapBuildState* createBuildState(uint32 mapID, uint32 tileCount);
+        MapBuildState* getBuildState(uint32 mapID) const;
+        void loadTileHashes(uint32 mapID, MapBuildState& state) const;
+        void saveTileHashes(uint32 mapID, MapBuildState& state) const;
+        uint64 getTileInputHash(uint32 mapID, uint32 tileX, uint32 tileY, dtNavMeshParams const& navMeshParams);
+        uint64 getVMapTreeHash(uint32 mapID);
+        uint64 getModelHash(std::string const& name);
+        void onTileDone(uint32 mapID, uint32 tileX, uint32 tileY, uint64 inputHash, bool built, bool hasTile, uint32 startTime);
+        void printBuildReport(uint32 startTime) const;
+        void readOffMeshLines();
+
         TerrainBuilder* m_terrainBuilder{nullptr};
         TileList m_tiles;
 
@@ -213,6 +254,14 @@ namespace MMAP
         // build performance - not really used for now
         rcContext* m_rcContext{nullptr};
 
+        // created before any tile is queued, so the workers can look them up without locking
+        std::map<uint32, std::unique_ptr<MapBuildState>> m_buildStates;
+        std::unordered_map<uint64, std::string> m_offMeshLines;    // lines of the off-mesh file per map and tile
+
+        // model files are shared by many tiles, hash each of them only once
+        std::mutex m_modelHashLock;
+        std::unordered_map<std::string, uint64> m_modelHashes;
+
         std::vector<TileBuilder*> m_tileBuilders;
         ProducerConsumerQueue<TileInfo> _queue;
         std::atomic<bool> _cancelationToken;
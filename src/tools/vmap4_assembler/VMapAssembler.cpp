@@ -15,8 +15,10 @@
  * with this program. If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <cstring>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include "TileAssembler.h"
 
@@ -24,23 +26,27 @@ int main(int argc, char* argv[])
 {
     std::string src = "Buildings";
     std::string dest = "vmaps";
+    unsigned int threads = std::thread::hardware_concurrency();
 
-    if (argc > 3)
+    int positional = 0;
+    for (int i = 1; i < argc; ++i)
     {
-        std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir>" << std::endl;
-        return 1;
-    }
-    else
-    {
-        if (argc > 1)
-            src = argv[1];
-        if (argc > 2)
-            dest = argv[2];
+        if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = atoi(argv[++i]);
+        else if (positional == 0)
+            src = argv[i], ++positional;
+        else if (positional == 1)
+            dest = argv[i], ++positional;
+        else
+        {
+            std::cout << "usage: " << argv[0] << " <raw data dir> <vmap dest dir> [--threads <count>]" << std::endl;
+            return 1;
+        }
     }
 
     std::cout << "using " << src << " as source directory and writing output to " << dest << std::endl;
 
-    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest);
+    VMAP::TileAssembler* ta = new VMAP::TileAssembler(src, dest, threads);
 
     if (!ta->convertWorld2())
     {